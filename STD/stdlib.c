@@ -2,11 +2,14 @@
 #include <STD/stdlib.h>
 #include <STD/stdint.h>
 
-#define MEMORY_POOL_SIZE 0x90000
-
 /**
  * @brief Memory block
  *
+ * Large blocks are framed by this header and a footer holding a copy of
+ * `size`, so both physical neighbours are reachable in O(1). Free large
+ * blocks are chained in a doubly linked list (`prev`, `next`); small
+ * blocks only use `next` to link their size class.
+ *
  */
 typedef struct mem_block
 {
@@ -14,66 +17,287 @@ typedef struct mem_block
     size_t size;
     int32_t free;
 
+    struct mem_block *prev;
     struct mem_block *next;
 
 } mem_block_t;
 
-/* Memory pool */
-static char memory[MEMORY_POOL_SIZE];
+/* End of the last region given by morecore */
+static char *heap_end = NULL;
 
-/* Head */
+/* Free large blocks */
 static mem_block_t *head = NULL;
 
 #define ALIGN4(x) (((x) + 3) & ~3)
 
 #define BLOCK_SIZE sizeof(mem_block_t)
+#define FOOTER_SIZE sizeof(size_t)
+
+/* Footer of a block (size, lowest bit set when free) */
+#define FOOTER(block) ((size_t *)((char *)(block) + BLOCK_SIZE + (block)->size))
+/* Physical neighbours */
+#define NEXT_BLOCK(block) ((mem_block_t *)((char *)(block) + BLOCK_SIZE + (block)->size + FOOTER_SIZE))
+#define PREV_FOOTER(block) (*(size_t *)((char *)(block) - FOOTER_SIZE))
+#define PREV_BLOCK(block) ((mem_block_t *)((char *)(block) - FOOTER_SIZE - (PREV_FOOTER(block) & ~1UL) - BLOCK_SIZE))
+
+/* Smallest remainder worth splitting */
+#define MIN_SPLIT (BLOCK_SIZE + FOOTER_SIZE + 16)
 
 /**
- * @brief Memory allocation
+ * Size classes
+ *
+ * Requests up to SMALL_MAX bytes (tokens, nodes, memory cells, argument
+ * frames, short strings) are rounded up to a multiple of SMALL_STEP and
+ * served from a per-class free list. Objects of a class are carved from a slab taken
+ * from the pool and are never merged back: both malloc and free are O(1).
+ *
+ */
+
+#define SMALL_STEP 8
+#define SMALL_MAX 128
+#define SMALL_BINS (SMALL_MAX / SMALL_STEP)
+#define SMALL_SLAB 2048
+
+#define SMALL_CLASS(x) (((x) + SMALL_STEP - 1) / SMALL_STEP - !!(x))
+
+/* Free lists (one per size class) */
+static mem_block_t *bins[SMALL_BINS] = {NULL};
+
+/* Statistics */
+static malloc_stats_t stats = {0};
+
+/**
+ * @brief Write the header state and the footer of a large block
+ *
+ * @param block
+ * @param free
+ */
+static inline void block_mark(mem_block_t *block, int32_t free)
+{
+    block->free = free;
+    *FOOTER(block) = block->size | (free ? 1 : 0);
+}
+
+/**
+ * @brief Insert a large block in the free list
  *
+ * @param block
+ */
+static inline void block_link(mem_block_t *block)
+{
+    block->prev = NULL;
+    block->next = head;
+
+    if (head)
+        head->prev = block;
+
+    head = block;
+    block_mark(block, 1);
+}
+
+/**
+ * @brief Remove a large block from the free list
+ *
+ * @param block
+ */
+static inline void block_unlink(mem_block_t *block)
+{
+    if (block->prev)
+        block->prev->next = block->next;
+    else
+        head = block->next;
+
+    if (block->next)
+        block->next->prev = block->prev;
+}
+
+/**
+ * @brief Release a large block: merge it with its free neighbours
+ *
+ * @param block
+ */
+static void block_release(mem_block_t *block)
+{
+    // Merge with the next block
+    mem_block_t *next = NEXT_BLOCK(block);
+
+    if (next->free)
+    {
+        block_unlink(next);
+        block->size += FOOTER_SIZE + BLOCK_SIZE + next->size;
+    }
+
+    // Merge with the previous block
+    if (PREV_FOOTER(block) & 1)
+    {
+        mem_block_t *prev = PREV_BLOCK(block);
+
+        block_unlink(prev);
+        prev->size += FOOTER_SIZE + BLOCK_SIZE + block->size;
+        block = prev;
+    }
+
+    block_link(block);
+}
+
+/**
+ * @brief Hand a region of memory to the allocator
+ *
+ * The region starts with an allocated footer (prologue) and ends with an
+ * allocated, empty header (epilogue), so coalescing never leaves it. A
+ * region that directly follows the previous one takes over its epilogue.
+ *
+ * @param region
  * @param size
- * @return void*
  */
-void *malloc(size_t size)
+static void heap_region(char *region, size_t size)
 {
-    size = ALIGN4(size);
+    size = size & ~3UL;
 
-    if (!head)
+    if (size < FOOTER_SIZE + MIN_SPLIT + BLOCK_SIZE)
+        return;
+
+    mem_block_t *block = NULL;
+
+    if (region == heap_end)
+    {
+        // The old epilogue becomes the header of the new block
+        block = (mem_block_t *)(region - BLOCK_SIZE);
+        block->size = size - FOOTER_SIZE - BLOCK_SIZE;
+    }
+    else
     {
-        head = (mem_block_t *)memory;
-        head->size = MEMORY_POOL_SIZE - BLOCK_SIZE;
-        head->free = 1;
-        head->next = NULL;
+        // Prologue
+        *(size_t *)region = 0;
+
+        block = (mem_block_t *)(region + FOOTER_SIZE);
+        block->size = size - FOOTER_SIZE - BLOCK_SIZE - FOOTER_SIZE - BLOCK_SIZE;
     }
 
-    mem_block_t *curr = head;
+    // Epilogue
+    mem_block_t *epilogue = NEXT_BLOCK(block);
+    epilogue->size = 0;
+    epilogue->free = 0;
+
+    heap_end = region + size;
+    stats.heap += size;
+
+    block_mark(block, 0);
+    block_release(block);
+}
 
-    while (curr)
+/**
+ * @brief First-fit allocation in the free list (large blocks and slabs)
+ *
+ * @param size
+ * @return void*
+ */
+static void *malloc_large(size_t size)
+{
+    size = ALIGN4(size);
+
+    for (unsigned char grown = 0; grown < 2; grown++)
     {
-        if (curr->free && curr->size >= size)
+        for (mem_block_t *curr = head; curr; curr = curr->next)
         {
-            if (curr->size >= size + BLOCK_SIZE + 4)
-            {
-                mem_block_t *new_block = (mem_block_t *)((char *)curr + BLOCK_SIZE + size);
+            if (curr->size < size)
+                continue;
 
-                new_block->size = curr->size - size - BLOCK_SIZE;
-                new_block->free = 1;
-                new_block->next = curr->next;
+            block_unlink(curr);
+
+            if (curr->size >= size + MIN_SPLIT)
+            {
+                size_t rest = curr->size - size - FOOTER_SIZE - BLOCK_SIZE;
 
                 curr->size = size;
-                curr->next = new_block;
+
+                mem_block_t *new_block = NEXT_BLOCK(curr);
+                new_block->size = rest;
+                block_link(new_block);
             }
 
-            curr->free = 0;
+            block_mark(curr, 0);
             return (char *)curr + BLOCK_SIZE;
         }
 
-        curr = curr->next;
+        // No block is large enough: ask the kernel for more memory
+        size_t granted = 0;
+        char *region = (char *)morecore(size + 2 * (FOOTER_SIZE + BLOCK_SIZE), &granted);
+
+        if (!region)
+            break;
+
+        heap_region(region, granted);
     }
 
     return NULL;
 }
 
+/**
+ * @brief Refill a size class with a new slab
+ *
+ * @param bin
+ * @return mem_block_t*
+ */
+static mem_block_t *malloc_refill(size_t bin)
+{
+    size_t size = (bin + 1) * SMALL_STEP;
+    char *slab = (char *)malloc_large(SMALL_SLAB);
+
+    if (!slab)
+        return NULL;
+
+    // Cut the slab into blocks of the same class
+    for (char *ptr = slab; ptr + BLOCK_SIZE + size <= slab + SMALL_SLAB; ptr += BLOCK_SIZE + size)
+    {
+        mem_block_t *block = (mem_block_t *)ptr;
+
+        block->size = size;
+        block->free = 1;
+        block->next = bins[bin];
+
+        bins[bin] = block;
+    }
+
+    stats.slabs++;
+    return bins[bin];
+}
+
+/**
+ * @brief Memory allocation
+ *
+ * @param size
+ * @return void*
+ */
+void *malloc(size_t size)
+{
+    void *ptr = NULL;
+
+    if (size <= SMALL_MAX)
+    {
+        size_t bin = SMALL_CLASS(size);
+        mem_block_t *block = bins[bin];
+
+        if (!block && !(block = malloc_refill(bin)))
+            return NULL;
+
+        bins[bin] = block->next;
+        block->free = 0;
+        block->next = NULL;
+
+        ptr = (char *)block + BLOCK_SIZE;
+        stats.small++;
+    }
+
+    else if (!(ptr = malloc_large(size)))
+        return NULL;
+
+    stats.allocations++;
+    stats.used += ((mem_block_t *)((char *)ptr - BLOCK_SIZE))->size;
+
+    return ptr;
+}
+
 /**
  * @brief Free allocated memory
  *
@@ -85,26 +309,386 @@ void free(void *ptr)
         return;
 
     mem_block_t *block = (mem_block_t *)((char *)ptr - BLOCK_SIZE);
-    block->free = 1;
 
-    while (block->next && block->next->free)
+    stats.frees++;
+    stats.used -= block->size;
+
+    // Small blocks go back to their size class
+    if (block->size <= SMALL_MAX)
+    {
+        size_t bin = SMALL_CLASS(block->size);
+
+        block->free = 1;
+        block->next = bins[bin];
+        bins[bin] = block;
+        return;
+    }
+
+    block_release(block);
+}
+
+/**
+ * @brief Resize allocated memory (grows in place when possible)
+ *
+ * @param ptr
+ * @param size
+ * @return void* (NULL if out of memory: ptr is left untouched)
+ */
+void *realloc(void *ptr, size_t size)
+{
+    if (!ptr)
+        return malloc(size);
+
+    if (!size)
     {
-        block->size += BLOCK_SIZE + block->next->size;
-        block->next = block->next->next;
+        free(ptr);
+        return NULL;
     }
 
-    mem_block_t *curr = head;
+    mem_block_t *block = (mem_block_t *)((char *)ptr - BLOCK_SIZE);
+
+    // Rounding already left enough room
+    if (size <= block->size)
+        return ptr;
+
+    // Large block followed by a free block: take it over
+    mem_block_t *next = NEXT_BLOCK(block);
+    size = ALIGN4(size);
 
-    while (curr && curr->next)
+    if (block->size > SMALL_MAX && next->free && block->size + FOOTER_SIZE + BLOCK_SIZE + next->size >= size)
     {
-        if (curr->next == block && curr->free)
+        stats.used -= block->size;
+
+        block_unlink(next);
+        block->size += FOOTER_SIZE + BLOCK_SIZE + next->size;
+
+        if (block->size >= size + MIN_SPLIT)
         {
-            curr->size += BLOCK_SIZE + block->size;
-            curr->next = block->next;
-            break;
+            size_t rest = block->size - size - FOOTER_SIZE - BLOCK_SIZE;
+
+            block->size = size;
+
+            mem_block_t *new_block = NEXT_BLOCK(block);
+            new_block->size = rest;
+            block_link(new_block);
         }
-        curr = curr->next;
+
+        block_mark(block, 0);
+        stats.used += block->size;
+
+        return ptr;
+    }
+
+    void *result = malloc(size);
+
+    if (!result)
+        return NULL;
+
+    memmove(result, ptr, block->size);
+    free(ptr);
+
+    return result;
+}
+
+/**
+ * @brief Usable size of allocated memory (at least the size requested)
+ *
+ * @param ptr
+ * @return size_t
+ */
+size_t msize(void *ptr)
+{
+    return ptr ? ((mem_block_t *)((char *)ptr - BLOCK_SIZE))->size : 0;
+}
+
+/**
+ * @brief Allocator statistics
+ *
+ * @return malloc_stats_t
+ */
+malloc_stats_t mstats(void)
+{
+    stats.free_blocks = 0;
+    stats.free_bytes = 0;
+    stats.largest = 0;
+
+    // Walk the free list (fragmentation report)
+    for (mem_block_t *curr = head; curr; curr = curr->next)
+    {
+        stats.free_blocks++;
+        stats.free_bytes += curr->size;
+
+        if (curr->size > stats.largest)
+            stats.largest = curr->size;
     }
+
+    return stats;
+}
+
+/* Word with a zero byte (has-zero-byte trick) */
+#define HAS_ZERO(w) (((w) - 0x01010101U) & ~(w) & 0x80808080U)
+
+/* Byte repeated in the 4 bytes of a word */
+#define REPEAT(c) ((uint32_t)(unsigned char)(c) * 0x01010101U)
+
+/* Pointer aligned on a word */
+#define ALIGNED4(p) (!((uintptr_t)(p) & 3))
+
+/* Below this size, a byte loop beats the startup of rep movs/stos */
+#define REP_MIN 0x20
+
+/**
+ * @brief Copy memory: 4 bytes at a time, then the remaining bytes
+ *
+ * @param destination
+ * @param source
+ * @param size
+ * @return void*
+ */
+static void *memcpy_rep(void *destination, const void *source, size_t size)
+{
+    if (size < REP_MIN)
+    {
+        for (size_t i = 0; i < size; i++)
+            ((unsigned char *)destination)[i] = ((const unsigned char *)source)[i];
+        return destination;
+    }
+
+    void *d = destination;
+    const void *s = source;
+    size_t words = size >> 2;
+    size_t bytes = size & 3;
+
+    __asm__ volatile("rep movsl" : "+D"(d), "+S"(s), "+c"(words) : : "memory");
+    __asm__ volatile("rep movsb" : "+D"(d), "+S"(s), "+c"(bytes) : : "memory");
+
+    return destination;
+}
+
+/**
+ * @brief Fill memory: 4 bytes at a time, then the remaining bytes
+ *
+ * @param destination
+ * @param value
+ * @param size
+ * @return void*
+ */
+static void *memset_rep(void *destination, int value, size_t size)
+{
+    if (size < REP_MIN)
+    {
+        for (size_t i = 0; i < size; i++)
+            ((unsigned char *)destination)[i] = (unsigned char)value;
+        return destination;
+    }
+
+    void *d = destination;
+    size_t words = size >> 2;
+    size_t bytes = size & 3;
+
+    __asm__ volatile("rep stosl" : "+D"(d), "+c"(words) : "a"(REPEAT(value)) : "memory");
+    __asm__ volatile("rep stosb" : "+D"(d), "+c"(bytes) : "a"(REPEAT(value)) : "memory");
+
+    return destination;
+}
+
+/**
+ * @brief String length: 4 bytes at a time once aligned
+ *
+ * An aligned word never crosses a page, so reading past the end is safe.
+ *
+ * @param string
+ * @return size_t
+ */
+static size_t strlen_word(const char *string)
+{
+    const char *c = string;
+
+    for (; !ALIGNED4(c); c++)
+        if (!*c)
+            return c - string;
+
+    const uint32_t *word = (const uint32_t *)c;
+
+    while (!HAS_ZERO(*word))
+        word++;
+
+    for (c = (const char *)word; *c; c++)
+        ;
+
+    return c - string;
+}
+
+/* Above this size, rep movs/stos (fast strings) beat the SSE2 loops */
+#define SSE2_MAX 0x800
+
+/**
+ * @brief Copy memory: 32 bytes at a time (SSE2), then memcpy_rep
+ *
+ * @param destination
+ * @param source
+ * @param size
+ * @return void*
+ */
+__attribute__((target("sse2"))) static void *memcpy_sse2(void *destination, const void *source, size_t size)
+{
+    char *d = destination;
+    const char *s = source;
+    size_t blocks = size >> 5;
+
+    if (size > SSE2_MAX)
+        return memcpy_rep(destination, source, size);
+
+    if (blocks)
+        __asm__ volatile("1:\n\t"
+                         "movdqu (%1), %%xmm0\n\t"
+                         "movdqu 16(%1), %%xmm1\n\t"
+                         "movdqu %%xmm0, (%0)\n\t"
+                         "movdqu %%xmm1, 16(%0)\n\t"
+                         "addl $32, %1\n\t"
+                         "addl $32, %0\n\t"
+                         "decl %2\n\t"
+                         "jnz 1b"
+                         : "+r"(d), "+r"(s), "+r"(blocks)
+                         :
+                         : "xmm0", "xmm1", "memory", "cc");
+
+    memcpy_rep(d, s, size & 31);
+    return destination;
+}
+
+/**
+ * @brief Fill memory: 32 bytes at a time (SSE2), then memset_rep
+ *
+ * @param destination
+ * @param value
+ * @param size
+ * @return void*
+ */
+__attribute__((target("sse2"))) static void *memset_sse2(void *destination, int value, size_t size)
+{
+    char *d = destination;
+    size_t blocks = size >> 5;
+
+    if (size > SSE2_MAX)
+        return memset_rep(destination, value, size);
+
+    if (blocks)
+        __asm__ volatile("movd %2, %%xmm0\n\t"
+                         "pshufd $0, %%xmm0, %%xmm0\n\t"
+                         "1:\n\t"
+                         "movdqu %%xmm0, (%0)\n\t"
+                         "movdqu %%xmm0, 16(%0)\n\t"
+                         "addl $32, %0\n\t"
+                         "decl %1\n\t"
+                         "jnz 1b"
+                         : "+r"(d), "+r"(blocks)
+                         : "r"(REPEAT(value))
+                         : "xmm0", "memory", "cc");
+
+    memset_rep(d, value, size & 31);
+    return destination;
+}
+
+/**
+ * @brief String length: 16 bytes at a time (SSE2)
+ *
+ * Blocks are aligned on 16 bytes, so they never cross a page.
+ *
+ * @param string
+ * @return size_t
+ */
+__attribute__((target("sse2"))) static size_t strlen_sse2(const char *string)
+{
+    const char *block = (const char *)((uintptr_t)string & ~(uintptr_t)15);
+    unsigned int mask;
+
+    __asm__("pxor %%xmm0, %%xmm0\n\t"
+            "pcmpeqb (%1), %%xmm0\n\t"
+            "pmovmskb %%xmm0, %0"
+            : "=r"(mask)
+            : "r"(block), "m"(*(const char(*)[16])block)
+            : "xmm0");
+
+    // Ignore the bytes before the string
+    mask >>= string - block;
+
+    while (!mask)
+    {
+        block += 16;
+
+        __asm__("pxor %%xmm0, %%xmm0\n\t"
+                "pcmpeqb (%1), %%xmm0\n\t"
+                "pmovmskb %%xmm0, %0"
+                : "=r"(mask)
+                : "r"(block), "m"(*(const char(*)[16])block)
+                : "xmm0");
+
+        if (mask)
+            return block - string + __builtin_ctz(mask);
+    }
+
+    return __builtin_ctz(mask);
+}
+
+/* Implementations selected by stdlib_init */
+static void *(*memcpy_impl)(void *, const void *, size_t) = memcpy_rep;
+static void *(*memset_impl)(void *, int, size_t) = memset_rep;
+static size_t (*strlen_impl)(const char *) = strlen_word;
+
+/* Features given to stdlib_init */
+static unsigned int features_used = 0;
+
+/**
+ * @brief Select the string and memory functions
+ *
+ * @param features STDLIB_* flags usable on this processor
+ */
+void stdlib_init(unsigned int features)
+{
+    unsigned int sse2 = features & STDLIB_SSE2;
+
+    memcpy_impl = sse2 ? memcpy_sse2 : memcpy_rep;
+    memset_impl = sse2 ? memset_sse2 : memset_rep;
+    strlen_impl = sse2 ? strlen_sse2 : strlen_word;
+
+    features_used = sse2;
+}
+
+/**
+ * @brief Features used by the string and memory functions
+ *
+ * @return unsigned int STDLIB_* flags
+ */
+unsigned int stdlib_features(void)
+{
+    return features_used;
+}
+
+/**
+ * @brief Copy a block of memory (the blocks must not overlap)
+ *
+ * @param destination
+ * @param source
+ * @param size
+ * @return void*
+ */
+void *memcpy(void *destination, const void *source, size_t size)
+{
+    return memcpy_impl(destination, source, size);
+}
+
+/**
+ * @brief Fill a block of memory with a byte
+ *
+ * @param destination
+ * @param value
+ * @param size
+ * @return void*
+ */
+void *memset(void *destination, int value, size_t size)
+{
+    return memset_impl(destination, value, size);
 }
 
 /**
@@ -139,12 +723,34 @@ void *memmove(void *destination, const void *source, size_t size)
     if (d == s || size == 0)
         return destination;
 
-    if (d < s)
-        for (size_t i = 0; i < size; i++)
-            d[i] = s[i];
-    else
+    // A forward copy never overwrites bytes it has yet to read
+    if (d < s || d >= s + size)
+        return memcpy(destination, source, size);
+
+    if (size < REP_MIN)
+    {
         for (size_t i = size; i > 0; i--)
             d[i - 1] = s[i - 1];
+        return destination;
+    }
+
+    size_t bytes = size & 3;
+    size_t words = size >> 2;
+
+    d += size - 1;
+    s += size - 1;
+
+    // Backward copy (direction flag set): the last bytes, then the words
+    __asm__ volatile("std\n\t"
+                     "rep movsb\n\t"
+                     "subl $3, %%esi\n\t"
+                     "subl $3, %%edi\n\t"
+                     "movl %3, %%ecx\n\t"
+                     "rep movsl\n\t"
+                     "cld"
+                     : "+D"(d), "+S"(s), "+c"(bytes)
+                     : "r"(words)
+                     : "memory", "cc");
 
     return destination;
 }
@@ -158,10 +764,32 @@ void *memmove(void *destination, const void *source, size_t size)
  */
 unsigned char strcmp(char *str1, char *str2)
 {
-    for (unsigned long long i = 0; str1[i] || str2[i]; i++)
-        if (str1[i] != str2[i])
-            return 1;
-    return 0;
+    // Same alignment: compare 4 bytes at a time
+    if (((uintptr_t)str1 & 3) == ((uintptr_t)str2 & 3))
+    {
+        for (; !ALIGNED4(str1); str1++, str2++)
+            if (*str1 != *str2)
+                return 1;
+            else if (!*str1)
+                return 0;
+
+        const uint32_t *word1 = (const uint32_t *)str1;
+        const uint32_t *word2 = (const uint32_t *)str2;
+
+        while (*word1 == *word2 && !HAS_ZERO(*word1))
+        {
+            word1++;
+            word2++;
+        }
+
+        str1 = (char *)word1;
+        str2 = (char *)word2;
+    }
+
+    for (; *str1 == *str2; str1++, str2++)
+        if (!*str1)
+            return 0;
+    return 1;
 }
 
 /**
@@ -173,10 +801,25 @@ unsigned char strcmp(char *str1, char *str2)
  */
 char *strchr(const char *string, int character)
 {
-    for (; *string; string++)
-        if (*string == (char)character)
+    char c = (char)character;
+
+    for (; !ALIGNED4(string); string++)
+        if (*string == c)
             return (char *)string;
-    return !character ? (char *)string : NULL;
+        else if (!*string)
+            return NULL;
+
+    // Stop on the word holding the end or the character
+    const uint32_t *word = (const uint32_t *)string;
+    uint32_t mask = REPEAT(c);
+
+    while (!HAS_ZERO(*word) && !HAS_ZERO(*word ^ mask))
+        word++;
+
+    for (string = (const char *)word; *string != c; string++)
+        if (!*string)
+            return NULL;
+    return (char *)string;
 }
 
 /**
@@ -213,14 +856,11 @@ char *strstr(const char *haystack, const char *needle)
  * @brief String length
  *
  * @param string
- * @return long long
+ * @return size_t
  */
-long long strlen(const char *string)
+size_t strlen(const char *string)
 {
-    for (long long i = 0; 1; i++)
-        if (!string[i])
-            return i;
-    return 0;
+    return strlen_impl(string);
 }
 
 /**
@@ -338,11 +978,7 @@ char *itoa(char *buff, int size, int value)
  */
 void strcat(char *dest, const char *string)
 {
-    while (*dest)
-        dest++;
-    while (*string)
-        *dest++ = *string++;
-    *dest = 0;
+    strcpy(dest + strlen(dest), string);
 }
 
 /**
@@ -353,8 +989,5 @@ void strcat(char *dest, const char *string)
  */
 void strcpy(char *dest, const char *string)
 {
-    unsigned long long i = 0;
-    for (; string[i]; i++)
-        dest[i] = string[i];
-    dest[i] = 0;
+    memcpy(dest, string, strlen(string) + 1);
 }
@@ -19,4 +19,7 @@ extern start
 
 _start:
     mov esp, 0x90000
+    ; start(magic, multiboot_info)
+    push ebx
+    push eax
     call start
@@ -0,0 +1,103 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Arena.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+/* Default chunk capacity */
+#define ARENA_CHUNK_SIZE 0x1000
+
+/* Alignment of the allocations */
+#define ARENA_ALIGN(x) (((x) + 3) & ~3)
+
+// Arena used by Token, Branch and the tokenizer (NULL: malloc)
+Arena *ARENA = NULL;
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * @param arena
+ * @param size
+ * @return void*
+ */
+void *ArenaAlloc(Arena *arena, size_t size)
+{
+    size = ARENA_ALIGN(size);
+    arena_chunk *chunk = arena->chunk;
+
+    if (!chunk || chunk->used + size > chunk->size)
+    {
+        size_t capacity = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+
+        if (!(chunk = (arena_chunk *)malloc(sizeof(arena_chunk) + capacity)))
+            return __SOARE_OUT_OF_MEMORY();
+
+        chunk->size = capacity;
+        chunk->used = 0;
+        chunk->next = arena->chunk;
+
+        arena->chunk = chunk;
+    }
+
+    void *ptr = (char *)(chunk + 1) + chunk->used;
+    chunk->used += size;
+
+    return ptr;
+}
+
+/**
+ * @brief Allocate from ARENA if set, malloc otherwise
+ *
+ * @param size
+ * @return void*
+ */
+void *ArenaMalloc(size_t size)
+{
+    return ARENA ? ArenaAlloc(ARENA, size) : malloc(size);
+}
+
+/**
+ * @brief String duplicate in ARENA if set, strdup otherwise
+ *
+ * @param string
+ * @return char*
+ */
+char *ArenaStrdup(const char *string)
+{
+    if (!string || !ARENA)
+        return strdup(string);
+
+    char *result = (char *)ArenaAlloc(ARENA, strlen(string) + 1);
+
+    if (result)
+        strcpy(result, string);
+
+    return result;
+}
+
+/**
+ * @brief Release all the memory of an arena
+ *
+ * @param arena
+ */
+void ArenaFree(Arena *arena)
+{
+    while (arena->chunk)
+    {
+        arena_chunk *next = arena->chunk->next;
+        free(arena->chunk);
+        arena->chunk = next;
+    }
+}
@@ -0,0 +1,158 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Atom.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+// Atoms by hash of their characters (open addressing, NULL: empty)
+static char **ATOMS = NULL;
+// Size of ATOMS (power of 2, at least twice ATOMS_COUNT)
+static size_t ATOMS_SIZE = 0;
+// Number of atoms
+static size_t ATOMS_COUNT = 0;
+
+// Characters of the atoms (never released: any program may use them)
+static Arena ATOMS_ARENA = {NULL};
+
+/**
+ * @brief Hash the first characters of a string (FNV-1a)
+ *
+ * @param string
+ * @param length
+ * @return unsigned int
+ */
+static unsigned int AtomStringHash(const char *string, size_t length)
+{
+    unsigned int hash = 0x811C9DC5;
+
+    while (length--)
+        hash = (hash ^ (unsigned char)*string++) * 0x01000193;
+
+    return hash;
+}
+
+/**
+ * @brief Find the slot of a name: its atom, or the empty slot where it belongs
+ *
+ * @param string
+ * @param length
+ * @return char**
+ */
+static char **AtomSlot(const char *string, size_t length)
+{
+    size_t mask = ATOMS_SIZE - 1;
+    size_t slot = AtomStringHash(string, length) & mask;
+
+    for (; ATOMS[slot]; slot = (slot + 1) & mask)
+    {
+        char *atom = ATOMS[slot];
+        size_t i = 0;
+
+        while (i < length && atom[i] == string[i])
+            i++;
+
+        if (i == length && !atom[length])
+            return &ATOMS[slot];
+    }
+
+    return &ATOMS[slot];
+}
+
+/**
+ * @brief Double the size of the table
+ *
+ * @return unsigned char
+ */
+static unsigned char AtomGrow(void)
+{
+    size_t size = ATOMS_SIZE ? ATOMS_SIZE * 2 : 0x100;
+    char **atoms = (char **)malloc(size * sizeof(char *));
+
+    if (!atoms)
+        return 0;
+
+    for (size_t i = 0; i < size; i++)
+        atoms[i] = NULL;
+
+    char **previous = ATOMS;
+    size_t previous_size = ATOMS_SIZE;
+
+    ATOMS = atoms;
+    ATOMS_SIZE = size;
+
+    for (size_t i = 0; i < previous_size; i++)
+        if (previous[i])
+            *AtomSlot(previous[i], strlen(previous[i])) = previous[i];
+
+    free(previous);
+    return 1;
+}
+
+/**
+ * @brief Give the atom of the first characters of a string (created if needed)
+ *
+ * @param string
+ * @param length
+ * @return char* (NULL if there is not enough memory)
+ */
+char *AtomLength(const char *string, size_t length)
+{
+    if (!string)
+        return NULL;
+
+    if (ATOMS_COUNT * 2 >= ATOMS_SIZE && !AtomGrow())
+        return __SOARE_OUT_OF_MEMORY();
+
+    char **slot = AtomSlot(string, length);
+
+    if (*slot)
+        return *slot;
+
+    char *atom = (char *)ArenaAlloc(&ATOMS_ARENA, length + 1);
+
+    if (!atom)
+        return NULL;
+
+    memmove(atom, string, length);
+    atom[length] = 0;
+
+    ATOMS_COUNT++;
+    return *slot = atom;
+}
+
+/**
+ * @brief Give the atom of a name (created if needed)
+ *
+ * @param string
+ * @return char* (NULL if there is not enough memory)
+ */
+char *Atom(const char *string)
+{
+    return string ? AtomLength(string, strlen(string)) : NULL;
+}
+
+/**
+ * @brief Find the atom of a name, without creating it
+ *
+ * @param string
+ * @return char* (NULL if the name was never interned)
+ */
+char *AtomFind(const char *string)
+{
+    if (!string || !ATOMS)
+        return NULL;
+
+    return *AtomSlot(string, strlen(string));
+}
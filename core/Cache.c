@@ -0,0 +1,144 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Cache.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+// Parsed programs (empty: code is NULL)
+static Program CACHE[CACHE_ENTRIES];
+
+// Use counter (LRU)
+static unsigned int CLOCK = 0;
+
+// Statistics
+static soare_cache_stats STATS = {0};
+
+/**
+ * @brief Hash a source code (FNV-1a)
+ *
+ * @param code
+ * @return unsigned int
+ */
+static unsigned int CacheHash(char *code)
+{
+    unsigned int hash = 0x811C9DC5;
+
+    while (*code)
+        hash = (hash ^ (unsigned char)*code++) * 0x01000193;
+
+    return hash;
+}
+
+/**
+ * @brief Find a parsed program, and pin it
+ *
+ * @param file
+ * @param code
+ * @return Program* (NULL if the code was never parsed)
+ */
+Program *CacheGet(char *file, char *code)
+{
+    unsigned int hash = CacheHash(code);
+
+    for (unsigned int i = 0; i < CACHE_ENTRIES; i++)
+    {
+        Program *program = &CACHE[i];
+
+        if (!program->code || program->hash != hash)
+            continue;
+
+        if (strcmp(program->code, code) || strcmp(program->file, file))
+            continue;
+
+        program->pins++;
+        program->used = ++CLOCK;
+        STATS.hits++;
+
+        return program;
+    }
+
+    STATS.misses++;
+    return NULL;
+}
+
+/**
+ * @brief Move a parsed program into the cache (evicts the least recently used), and pin it
+ *
+ * @param program
+ * @return Program* (program itself if every entry is running)
+ */
+Program *CacheStore(Program *program)
+{
+    Program *slot = NULL;
+
+    // Free entry, or the least recently used entry that is not running
+    for (unsigned int i = 0; i < CACHE_ENTRIES; i++)
+    {
+        if (CACHE[i].pins)
+            continue;
+
+        if (!CACHE[i].code)
+        {
+            slot = &CACHE[i];
+            break;
+        }
+
+        if (!slot || CACHE[i].used < slot->used)
+            slot = &CACHE[i];
+    }
+
+    if (!slot)
+        return program;
+
+    if (slot->code)
+    {
+        ArenaFree(&slot->arena);
+        STATS.evictions++;
+        STATS.entries--;
+    }
+
+    *slot = *program;
+    slot->hash = CacheHash(slot->code);
+    slot->pins = 1;
+    slot->used = ++CLOCK;
+    slot->cached = 1;
+
+    STATS.entries++;
+
+    return slot;
+}
+
+/**
+ * @brief Unpin a program (a program outside the cache is released)
+ *
+ * @param program
+ */
+void CacheRelease(Program *program)
+{
+    if (program->cached)
+        program->pins--;
+    else
+        ArenaFree(&program->arena);
+}
+
+/**
+ * @brief Cache statistics
+ *
+ * @return soare_cache_stats
+ */
+soare_cache_stats soare_getcachestats(void)
+{
+    return STATS;
+}
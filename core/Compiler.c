@@ -0,0 +1,563 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Compiler.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+/* No pending jump */
+#define CHAIN_END -1
+
+/**
+ * @brief State of the compiler of one chunk
+ */
+typedef struct compiler
+{
+
+    // Code being emitted
+    int *code;
+    size_t size;
+    size_t capacity;
+
+    // Constant pool being filled
+    AST *constants;
+    size_t count;
+    size_t available;
+
+    // Value stack (current, deepest)
+    unsigned int depth;
+    unsigned int stack;
+
+    // Scope nesting (current, deepest)
+    unsigned int scope;
+    unsigned int scopes;
+
+    // Try nesting (current, deepest)
+    unsigned int try;
+    unsigned int tries;
+
+    // Something could not be compiled
+    unsigned char failed;
+
+} Compiler;
+
+/**
+ * @brief Make room for one more item in a buffer
+ *
+ * @param buffer
+ * @param capacity
+ * @param size
+ * @param item
+ * @return unsigned char (0: out of memory)
+ */
+static unsigned char Grow(void **buffer, size_t *capacity, size_t size, size_t item)
+{
+    if (size < *capacity)
+        return 1;
+
+    size_t capacity2 = *capacity ? *capacity * 2 : 64;
+    void *buffer2 = malloc(capacity2 * item);
+
+    if (!buffer2)
+        return 0;
+
+    if (*buffer)
+        memmove(buffer2, *buffer, size * item);
+
+    free(*buffer);
+    *buffer = buffer2;
+    *capacity = capacity2;
+
+    return 1;
+}
+
+/**
+ * @brief Emit a word
+ *
+ * @param compiler
+ * @param word
+ * @return int (position of the word)
+ */
+static int Emit(Compiler *compiler, int word)
+{
+    if (!Grow((void **)&compiler->code, &compiler->capacity, compiler->size, sizeof(int)))
+    {
+        compiler->failed = 1;
+        return 0;
+    }
+
+    compiler->code[compiler->size] = word;
+    return (int)compiler->size++;
+}
+
+/**
+ * @brief Add a node to the constant pool
+ *
+ * @param compiler
+ * @param node
+ * @return int (index of the constant)
+ */
+static int Constant(Compiler *compiler, AST node)
+{
+    if (!Grow((void **)&compiler->constants, &compiler->available, compiler->count, sizeof(AST)))
+    {
+        compiler->failed = 1;
+        return 0;
+    }
+
+    compiler->constants[compiler->count] = node;
+    return (int)compiler->count++;
+}
+
+/**
+ * @brief Emit a jump operand that will be patched later
+ *
+ * @param compiler
+ * @param chain pending operands (linked through their value)
+ */
+static void Chain(Compiler *compiler, int *chain)
+{
+    *chain = Emit(compiler, *chain);
+}
+
+/**
+ * @brief Patch all pending operands of a chain
+ *
+ * @param compiler
+ * @param chain
+ * @param target
+ */
+static void Patch(Compiler *compiler, int chain, int target)
+{
+    if (compiler->failed)
+        return;
+
+    while (chain != CHAIN_END)
+    {
+        int next = compiler->code[chain];
+        compiler->code[chain] = target;
+        chain = next;
+    }
+}
+
+/**
+ * @brief Update the value stack size
+ *
+ * @param compiler
+ * @param delta
+ */
+static void Stack(Compiler *compiler, int delta)
+{
+    compiler->depth += delta;
+
+    if (compiler->depth > compiler->stack)
+        compiler->stack = compiler->depth;
+}
+
+/**
+ * @brief Compile an expression (leaves one value on the stack)
+ *
+ * @param compiler
+ * @param tree
+ */
+static void CompileExpr(Compiler *compiler, AST tree)
+{
+    if (!tree)
+    {
+        Emit(compiler, OP_NULL);
+        Stack(compiler, 1);
+        return;
+    }
+
+    switch (tree->type)
+    {
+    case NODE_VALUE:
+        Emit(compiler, OP_PUSH);
+        Emit(compiler, Constant(compiler, tree));
+        Stack(compiler, 1);
+        break;
+
+    case NODE_MEMGET:
+        // The subscript is evaluated by MathSubscript
+        Emit(compiler, tree->child ? OP_SUBSCRIPT : OP_LOAD);
+        Emit(compiler, Constant(compiler, tree));
+        Stack(compiler, 1);
+
+        if (tree->child)
+            return;
+        break;
+
+    case NODE_CALL:
+        Emit(compiler, OP_CALL);
+        Emit(compiler, Constant(compiler, tree));
+        // Patched below if the result is indexed
+        Emit(compiler, 1);
+        Stack(compiler, 1);
+        break;
+
+    case NODE_OPERATOR:
+        CompileExpr(compiler, tree->child);
+        CompileExpr(compiler, tree->child->sibling);
+        Emit(compiler, OP_OPERATE);
+        Emit(compiler, MathOperator(tree->value));
+        Emit(compiler, Constant(compiler, tree));
+        Stack(compiler, -1);
+        // Operands are never indexed
+        return;
+
+    default:
+        compiler->failed = 1;
+        return;
+    }
+
+    AST array = tree->child;
+
+    while (array && array->type != NODE_ARRAY)
+        array = array->sibling;
+
+    if (!array)
+        return;
+
+    // Eval nulls a call only once it is indexed
+    if (tree->type == NODE_CALL && !compiler->failed)
+        compiler->code[compiler->size - 1] = 0;
+
+    int skip = CHAIN_END;
+
+    Emit(compiler, OP_SKIP_NULL);
+    Chain(compiler, &skip);
+    CompileExpr(compiler, array->child);
+    Emit(compiler, OP_INDEX);
+    Emit(compiler, Constant(compiler, array));
+    Stack(compiler, -1);
+
+    Patch(compiler, skip, (int)compiler->size);
+}
+
+/**
+ * @brief Compile a block of statements
+ *
+ * @param compiler
+ * @param tree
+ */
+static void CompileBlock(Compiler *compiler, AST tree);
+
+/**
+ * @brief Compile a function body in its own chunk
+ *
+ * @param tree
+ * @return Chunk*
+ */
+static Chunk *CompileChunk(AST tree);
+
+/**
+ * @brief Emit an instruction whose operands are a constant and the end of the block
+ *
+ * @param compiler
+ * @param op
+ * @param node
+ * @param end
+ */
+static void EmitStatement(Compiler *compiler, opcode op, AST node, int *end)
+{
+    Emit(compiler, op);
+    Emit(compiler, Constant(compiler, node));
+    Chain(compiler, end);
+}
+
+/**
+ * @brief Compile a statement
+ *
+ * @param compiler
+ * @param curr
+ * @param end jumps to the end of the block
+ */
+static void CompileStatement(Compiler *compiler, AST curr, int *end)
+{
+    switch (curr->type)
+    {
+    case NODE_FUNCTION:
+    {
+        // The body is compiled once, the definition is executed each time
+        AST body = curr->child;
+
+        while (body && body->type != NODE_BODY)
+            body = body->sibling;
+
+        if (body && !body->code)
+            body->code = CompileChunk(body);
+
+        EmitStatement(compiler, OP_FUNCTION, curr, end);
+    }
+    break;
+
+    case NODE_CALL:
+        // Not an expression: no index, no Eval
+        Emit(compiler, OP_CALL);
+        Emit(compiler, Constant(compiler, curr));
+        Emit(compiler, 0);
+        Stack(compiler, 1);
+        Emit(compiler, OP_POP);
+        Chain(compiler, end);
+        Stack(compiler, -1);
+        break;
+
+    case NODE_BREAK:
+        Emit(compiler, OP_BREAK);
+        Chain(compiler, end);
+        break;
+
+    case NODE_RETURN:
+        CompileExpr(compiler, curr->child);
+        Emit(compiler, OP_RETURN);
+        Chain(compiler, end);
+        Stack(compiler, -1);
+        break;
+
+    case NODE_RAISE:
+        EmitStatement(compiler, OP_RAISE, curr, end);
+        break;
+
+    case NODE_MEMNEW:
+        CompileExpr(compiler, curr->child);
+        EmitStatement(compiler, OP_DEFINE, curr, end);
+        Stack(compiler, -1);
+        break;
+
+    case NODE_MEMSET:
+        EmitStatement(compiler, OP_RESOLVE, curr, end);
+
+        // The operands are evaluated by MathAppend
+        if (MathIsAppend(curr))
+        {
+            EmitStatement(compiler, OP_APPEND, curr, end);
+            break;
+        }
+
+        CompileExpr(compiler, curr->child);
+        EmitStatement(compiler, OP_ASSIGN, curr, end);
+        Stack(compiler, -1);
+        break;
+
+    case NODE_CUSTOM_KEYWORD:
+        EmitStatement(compiler, OP_KEYWORD, curr, end);
+        break;
+
+    case NODE_CONDITION:
+    {
+        /**
+         *
+         *        <condition 1>
+         *        TEST next stop
+         *        <body 1>
+         *        BROKEN end
+         *        JUMP stop
+         * next:  <condition 2>
+         *        ...
+         *        <body n> (else)
+         *        BROKEN end
+         * stop:  CHECK end
+         *
+         */
+
+        int stop = CHAIN_END;
+
+        for (AST tmp = curr->child; tmp; tmp = tmp->sibling ? tmp->sibling->sibling : NULL)
+        {
+            // Else: the body always runs, and the chain ends
+            if (tmp->type == NODE_ELSE)
+            {
+                CompileBlock(compiler, tmp->sibling);
+                Emit(compiler, OP_BROKEN);
+                Chain(compiler, end);
+                break;
+            }
+
+            int next = CHAIN_END;
+
+            CompileExpr(compiler, tmp);
+            Emit(compiler, OP_TEST);
+            Chain(compiler, &next);
+            Chain(compiler, &stop);
+            Stack(compiler, -1);
+
+            CompileBlock(compiler, tmp->sibling);
+            Emit(compiler, OP_BROKEN);
+            Chain(compiler, end);
+            Emit(compiler, OP_JUMP);
+            Chain(compiler, &stop);
+
+            Patch(compiler, next, (int)compiler->size);
+        }
+
+        Patch(compiler, stop, (int)compiler->size);
+        Emit(compiler, OP_CHECK);
+        Chain(compiler, end);
+    }
+    break;
+
+    case NODE_REPETITION:
+    {
+        /**
+         *
+         * loop:  <condition>
+         *        WHILE exit
+         *        <body>
+         *        JUMP loop
+         * exit:  CHECK end
+         *
+         */
+
+        int loop = (int)compiler->size;
+        int exit = CHAIN_END;
+
+        CompileExpr(compiler, curr->child);
+        Emit(compiler, OP_WHILE);
+        Chain(compiler, &exit);
+        Stack(compiler, -1);
+
+        CompileBlock(compiler, curr->child ? curr->child->sibling : NULL);
+        Emit(compiler, OP_JUMP);
+        Emit(compiler, loop);
+
+        Patch(compiler, exit, (int)compiler->size);
+        Emit(compiler, OP_CHECK);
+        Chain(compiler, end);
+    }
+    break;
+
+    case NODE_TRY:
+    {
+        /**
+         *
+         *        TRY
+         *        <try>
+         *        CATCH skip
+         *        <iferror>
+         * skip:  BROKEN end
+         *        CHECK end
+         *
+         */
+
+        int skip = CHAIN_END;
+
+        Emit(compiler, OP_TRY);
+
+        if (++compiler->try > compiler->tries)
+            compiler->tries = compiler->try;
+
+        CompileBlock(compiler, curr->child);
+        compiler->try--;
+
+        Emit(compiler, OP_CATCH);
+        Chain(compiler, &skip);
+        CompileBlock(compiler, curr->child ? curr->child->sibling : NULL);
+
+        Patch(compiler, skip, (int)compiler->size);
+        Emit(compiler, OP_BROKEN);
+        Chain(compiler, end);
+        Emit(compiler, OP_CHECK);
+        Chain(compiler, end);
+    }
+    break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Compile a block of statements
+ *
+ * @param compiler
+ * @param tree
+ */
+static void CompileBlock(Compiler *compiler, AST tree)
+{
+    if (!tree)
+        return;
+
+    /**
+     *
+     *        ENTER end
+     *        <statements>
+     * end:   EXIT
+     *
+     */
+
+    int end = CHAIN_END;
+
+    if (++compiler->scope > compiler->scopes)
+        compiler->scopes = compiler->scope;
+
+    Emit(compiler, OP_ENTER);
+    Chain(compiler, &end);
+
+    for (AST curr = tree->child; curr && !compiler->failed; curr = curr->sibling)
+        CompileStatement(compiler, curr, &end);
+
+    Patch(compiler, end, (int)compiler->size);
+    Emit(compiler, OP_EXIT);
+
+    compiler->scope--;
+}
+
+/**
+ * @brief Compile a function body in its own chunk
+ *
+ * @param tree
+ * @return Chunk*
+ */
+static Chunk *CompileChunk(AST tree)
+{
+    Compiler compiler = {0};
+    Chunk *chunk = NULL;
+
+    CompileBlock(&compiler, tree);
+    Emit(&compiler, OP_HALT);
+
+    if (!compiler.failed && (chunk = ArenaMalloc(sizeof(Chunk))))
+    {
+        chunk->code = ArenaMalloc(compiler.size * sizeof(int));
+        chunk->constants = ArenaMalloc((compiler.count + 1) * sizeof(AST));
+
+        chunk->stack = compiler.stack;
+        chunk->scopes = compiler.scopes;
+        chunk->tries = compiler.tries;
+
+        if (chunk->code && chunk->constants)
+        {
+            memmove(chunk->code, compiler.code, compiler.size * sizeof(int));
+            memmove(chunk->constants, compiler.constants, compiler.count * sizeof(AST));
+        }
+        else
+            chunk = NULL;
+    }
+
+    free(compiler.code);
+    free(compiler.constants);
+
+    return chunk;
+}
+
+/**
+ * @brief Compile a tree, and the bodies of its functions (allocated in ARENA)
+ *
+ * @param tree
+ * @return Chunk* (NULL if the tree can only be interpreted)
+ */
+Chunk *Compile(AST tree)
+{
+    return tree ? CompileChunk(tree) : NULL;
+}
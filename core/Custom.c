@@ -30,9 +30,9 @@ Function Name:
     char *int_add(soare_arguments_list args)
 
 Arguments:
-    - args: A linked list of arguments passed to the function.
+    - args: The arguments passed to the function, evaluated once.
         Use soare_getarg(args, i) to retrieve the i-th argument
-        as a string.
+        as a string (do not free it).
 
 Return Value:
     - Returns NULL (no value returned to SOARE).
@@ -98,10 +98,158 @@ soare_addfunction("int_add", int_add);
 
 */
 
-/* Functions */
-static struct soare_functions functions_list[100];
+/*
+
+==============================================================
+Example: Native Function - Add Numbers (evaluated arguments)
+==============================================================
+
+Same function with the native calling convention: every argument
+is evaluated once, before the call, into an array of strings.
+
+----------------------------------------------------------
+Function Name:
+    char *int_add(unsigned int argc, char **argv)
+
+Arguments:
+    - argc: Number of arguments.
+    - argv: Arguments as strings (NULL if an argument has no
+        value), followed by NULL. Do not free them.
+
+----------------------------------------------------------
+Code:
+----------------------------------------------------------
+
+char *int_add(unsigned int argc, char **argv)
+{
+    int result = 0;
+
+    for (unsigned int i = 0; i < argc && argv[i]; i++)
+        result += atoi(argv[i]);
+
+    printf("%d", result);
+    return NULL;
+}
+
+Implement this function: soare_addnative(<function name>, <function>)
+
+soare_addnative("int_add", int_add);
+
+----------------------------------------------------------
+
+*/
+
+/* Functions (grows with soare_addfunction and soare_addnative) */
+static struct soare_functions *functions_list = NULL;
 /* Count */
 static size_t functions_count = 0;
+/* Capacity */
+static size_t functions_size = 0;
+
+/* Position in functions_list + 1 (0: empty), open addressing */
+static unsigned int *functions_index = NULL;
+/* Size of the index (power of 2, at least twice functions_size) */
+static size_t functions_index_size = 0;
+
+/**
+ * @brief Find a function in the index
+ *
+ * @param name atom (see Atom)
+ * @return struct soare_functions* (NULL if not found)
+ */
+static struct soare_functions *FunctionFind(char *name)
+{
+    if (!functions_index)
+        return NULL;
+
+    size_t mask = functions_index_size - 1;
+    size_t slot = ATOM_HASH(name) & mask;
+
+    for (; functions_index[slot]; slot = (slot + 1) & mask)
+        if (functions_list[functions_index[slot] - 1].name == name)
+            return &functions_list[functions_index[slot] - 1];
+
+    return NULL;
+}
+
+/**
+ * @brief Put a function of functions_list in the index
+ *
+ * @param position
+ */
+static void FunctionIndex(size_t position)
+{
+    size_t mask = functions_index_size - 1;
+    size_t slot = ATOM_HASH(functions_list[position].name) & mask;
+
+    while (functions_index[slot])
+        slot = (slot + 1) & mask;
+
+    functions_index[slot] = position + 1;
+}
+
+/**
+ * @brief Double the capacity of the registry and rebuild the index
+ *
+ * @return unsigned char (0: out of memory)
+ */
+static unsigned char FunctionGrow(void)
+{
+    size_t size = functions_size ? functions_size * 2 : 32;
+
+    struct soare_functions *list = malloc(size * sizeof(struct soare_functions));
+    unsigned int *index = malloc(size * 2 * sizeof(unsigned int));
+
+    if (!list || !index)
+    {
+        free(list);
+        free(index);
+        return 0;
+    }
+
+    if (functions_list)
+        memmove(list, functions_list, functions_count * sizeof(struct soare_functions));
+
+    free(functions_list);
+    free(functions_index);
+
+    functions_list = list;
+    functions_size = size;
+
+    functions_index = index;
+    functions_index_size = size * 2;
+
+    for (size_t i = 0; i < functions_index_size; i++)
+        functions_index[i] = 0;
+
+    // The first function added with a name stays the one found
+    for (size_t i = 0; i < functions_count; i++)
+        if (!FunctionFind(functions_list[i].name))
+            FunctionIndex(i);
+
+    return 1;
+}
+
+/**
+ * @brief Add a function to the registry
+ *
+ * @param fn
+ * @return unsigned int
+ */
+static unsigned int FunctionAdd(struct soare_functions fn)
+{
+    if (functions_count >= functions_size && !FunctionGrow())
+        return 0;
+
+    char *name = fn.name;
+    functions_list[functions_count] = fn;
+
+    if (!FunctionFind(name))
+        FunctionIndex(functions_count);
+
+    functions_count = functions_count + 1;
+    return functions_count;
+}
 
 /**
  * @brief Add defined function
@@ -112,16 +260,27 @@ static size_t functions_count = 0;
  */
 unsigned int soare_addfunction(char *name, char *(*function)(soare_arguments_list))
 {
-    if (functions_count >= 99 || !name || !function)
+    if (!name || !function)
         return 0;
 
-    struct soare_functions fn = {name, function};
+    struct soare_functions fn = {Atom(name), function, NULL};
+    return fn.name ? FunctionAdd(fn) : 0;
+}
 
-    functions_list[functions_count] = fn;
-    functions_list[functions_count + 1].name = NULL;
+/**
+ * @brief Add defined function, called with its arguments already evaluated
+ *
+ * @param name
+ * @param native
+ * @return unsigned int
+ */
+unsigned int soare_addnative(char *name, char *(*native)(unsigned int argc, char **argv))
+{
+    if (!name || !native)
+        return 0;
 
-    functions_count = functions_count + 1;
-    return functions_count;
+    struct soare_functions fn = {Atom(name), NULL, native};
+    return fn.name ? FunctionAdd(fn) : 0;
 }
 
 /**
@@ -132,16 +291,14 @@ unsigned int soare_addfunction(char *name, char *(*function)(soare_arguments_lis
  */
 soare_function soare_getfunction(char *name)
 {
-    static soare_function none = {NULL, NULL};
+    static soare_function none = {NULL, NULL, NULL};
 
-    if (!name)
+    // A name that was never interned is not a function
+    if (!(name = AtomFind(name)))
         return none;
 
-    for (size_t i = 0; i < functions_count; i++)
-        if (!strcmp(functions_list[i].name, name))
-            return functions_list[i];
-
-    return none;
+    struct soare_functions *function = FunctionFind(name);
+    return function ? *function : none;
 }
 
 /**
@@ -153,9 +310,7 @@ soare_function soare_getfunction(char *name)
  */
 char *soare_getarg(soare_arguments_list args, unsigned int position)
 {
-    for (; position && args; position--)
-        args = args->sibling;
-    return Eval(args);
+    return args && position < args->argc ? args->argv[position] : NULL;
 }
 
 /*
@@ -193,6 +348,29 @@ static struct soare_keywords keywords_list[100];
 /* Count */
 static size_t keywords_count = 0;
 
+/* Size of the keyword index (power of 2, larger than keywords_list) */
+#define KEYWORDS_INDEX 0x100
+
+/* Position in keywords_list + 1 (0: empty), open addressing */
+static unsigned char keywords_index[KEYWORDS_INDEX];
+
+/**
+ * @brief Find a keyword in the index
+ *
+ * @param name atom (see Atom)
+ * @return struct soare_keywords* (NULL if not found)
+ */
+static struct soare_keywords *KeywordFind(char *name)
+{
+    unsigned int slot = ATOM_HASH(name) & (KEYWORDS_INDEX - 1);
+
+    for (; keywords_index[slot]; slot = (slot + 1) & (KEYWORDS_INDEX - 1))
+        if (keywords_list[keywords_index[slot] - 1].name == name)
+            return &keywords_list[keywords_index[slot] - 1];
+
+    return NULL;
+}
+
 /**
  * @brief Add defined keyword
  *
@@ -202,7 +380,7 @@ static size_t keywords_count = 0;
  */
 unsigned int soare_addkeyword(char *name, void (*keyword)(void))
 {
-    if (keywords_count >= 99 || !name || !keyword)
+    if (keywords_count >= 99 || !name || !keyword || !(name = Atom(name)))
         return 0;
 
     struct soare_keywords fn = {name, keyword};
@@ -210,6 +388,17 @@ unsigned int soare_addkeyword(char *name, void (*keyword)(void))
     keywords_list[keywords_count] = fn;
     keywords_list[keywords_count + 1].name = NULL;
 
+    // The first keyword added with a name stays the one found
+    if (!KeywordFind(name))
+    {
+        unsigned int slot = ATOM_HASH(name) & (KEYWORDS_INDEX - 1);
+
+        while (keywords_index[slot])
+            slot = (slot + 1) & (KEYWORDS_INDEX - 1);
+
+        keywords_index[slot] = (unsigned char)(keywords_count + 1);
+    }
+
     keywords_count = keywords_count + 1;
     return keywords_count;
 }
@@ -224,14 +413,11 @@ soare_keyword soare_getkeyword(char *name)
 {
     static soare_keyword none = {NULL, NULL};
 
-    if (!name)
+    if (!(name = AtomFind(name)))
         return none;
 
-    for (size_t i = 0; i < keywords_count; i++)
-        if (!strcmp(keywords_list[i].name, name))
-            return keywords_list[i];
-
-    return none;
+    struct soare_keywords *keyword = KeywordFind(name);
+    return keyword ? *keyword : none;
 }
 
 /**
@@ -242,12 +428,5 @@ soare_keyword soare_getkeyword(char *name)
  */
 unsigned char soare_iskeyword(char *name)
 {
-    if (!name)
-        return 0;
-
-    for (size_t i = 0; i < keywords_count; i++)
-        if (!strcmp(keywords_list[i].name, name))
-            return 1;
-
-    return 0;
+    return (name = AtomFind(name)) && KeywordFind(name);
 }
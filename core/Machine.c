@@ -0,0 +1,316 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Machine.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+/* Jump to the next instruction */
+#define DISPATCH() goto *dispatch[*ip++]
+
+/* Jump to a position in the code */
+#define JUMP(target) ip = chunk->code + (target)
+
+/* Jump to the end of the block if there is an error */
+#define CHECK() ErrorLevel() ? (void)(JUMP(ip[0])) : (void)(ip++)
+
+/**
+ * @brief Execute a chunk
+ *
+ * @param chunk
+ * @return Value
+ */
+Value Machine(Chunk *chunk)
+{
+    if (!chunk)
+        return ValueNull();
+
+    // Threaded dispatch: one label per opcode
+    static void *dispatch[] = {
+        [OP_NULL] = &&op_null,
+        [OP_PUSH] = &&op_push,
+        [OP_LOAD] = &&op_load,
+        [OP_CALL] = &&op_call,
+        [OP_OPERATE] = &&op_operate,
+        [OP_SKIP_NULL] = &&op_skip_null,
+        [OP_INDEX] = &&op_index,
+        [OP_SUBSCRIPT] = &&op_subscript,
+        [OP_POP] = &&op_pop,
+        [OP_DEFINE] = &&op_define,
+        [OP_RESOLVE] = &&op_resolve,
+        [OP_ASSIGN] = &&op_assign,
+        [OP_APPEND] = &&op_append,
+        [OP_FUNCTION] = &&op_function,
+        [OP_KEYWORD] = &&op_keyword,
+        [OP_RAISE] = &&op_raise,
+        [OP_BREAK] = &&op_break,
+        [OP_RETURN] = &&op_return,
+        [OP_ENTER] = &&op_enter,
+        [OP_EXIT] = &&op_exit,
+        [OP_TEST] = &&op_test,
+        [OP_WHILE] = &&op_while,
+        [OP_BROKEN] = &&op_broken,
+        [OP_CHECK] = &&op_check,
+        [OP_JUMP] = &&op_jump,
+        [OP_TRY] = &&op_try,
+        [OP_CATCH] = &&op_catch,
+        [OP_HALT] = &&op_halt,
+    };
+
+    // Values, scopes and exception states of this call
+    Value stack[chunk->stack + 1];
+    MEM scopes[chunk->scopes + 1];
+    unsigned char tries[chunk->tries + 1];
+
+    Value *sp = stack;
+    MEM *scope = scopes;
+    unsigned char *try = tries;
+
+    AST *constants = chunk->constants;
+    int *ip = chunk->code;
+
+    DISPATCH();
+
+op_null:
+    *sp++ = ValueNull();
+    DISPATCH();
+
+op_push:
+    // Literals are borrowed from the tree
+    *sp++ = ValueReference(constants[*ip++]->value);
+    DISPATCH();
+
+op_load:
+{
+    AST node = constants[*ip++];
+    MEM get = MemGet(MEMORY, node->value);
+
+    if (!get)
+        *sp++ = ValueException(UndefinedReference, node->value, node->file);
+    else if (get->body)
+        *sp++ = ValueException(VariableDefinedAsFunction, node->value, node->file);
+    else
+        *sp++ = ValueCopy(get->value);
+}
+    DISPATCH();
+
+op_call:
+{
+    Value value = RunFunction(constants[ip[0]]);
+
+    if (ip[1] && ErrorLevel())
+    {
+        ValueFree(value);
+        value = ValueNull();
+    }
+
+    *sp++ = value;
+    ip += 2;
+}
+    DISPATCH();
+
+op_operate:
+    sp--;
+    sp[-1] = MathApply((math_operator)ip[0], sp[-1], sp[0], constants[ip[1]]);
+    ip += 2;
+    DISPATCH();
+
+op_skip_null:
+    if (ValueIsNull(sp[-1]))
+        JUMP(ip[0]);
+    else
+        ip++;
+    DISPATCH();
+
+op_index:
+    sp--;
+    sp[-1] = MathIndex(sp[-1], sp[0], constants[*ip++]);
+
+    if (ErrorLevel())
+    {
+        ValueFree(sp[-1]);
+        sp[-1] = ValueNull();
+    }
+    DISPATCH();
+
+op_subscript:
+    *sp = MathSubscript(constants[*ip++]);
+
+    if (ErrorLevel())
+    {
+        ValueFree(*sp);
+        *sp = ValueNull();
+    }
+
+    sp++;
+    DISPATCH();
+
+op_pop:
+    ValueFree(*--sp);
+    CHECK();
+    DISPATCH();
+
+op_define:
+    MemPush(scope[-1], constants[*ip++]->value, *--sp);
+    CHECK();
+    DISPATCH();
+
+op_resolve:
+{
+    AST node = constants[*ip++];
+    MEM get = MemGet(MEMORY, node->value);
+
+    if (!get)
+        ValueException(UndefinedReference, node->value, node->file);
+    else if (get->body)
+        ValueException(VariableDefinedAsFunction, node->value, node->file);
+}
+    CHECK();
+    DISPATCH();
+
+op_assign:
+    // Checked by OP_RESOLVE: evaluating the value cannot remove the variable
+    MemSet(MemGet(MEMORY, constants[*ip++]->value), *--sp);
+    CHECK();
+    DISPATCH();
+
+op_append:
+{
+    // Checked by OP_RESOLVE
+    AST node = constants[*ip++];
+    MathAppend(MemGet(MEMORY, node->value), node);
+}
+    CHECK();
+    DISPATCH();
+
+op_function:
+{
+    AST node = constants[*ip++];
+    MemPushf(scope[-1], node->value, node);
+}
+    CHECK();
+    DISPATCH();
+
+op_keyword:
+{
+    soare_keyword keyword = soare_getkeyword(constants[*ip++]->value);
+    if (keyword.name)
+        keyword.exec();
+}
+    CHECK();
+    DISPATCH();
+
+op_raise:
+{
+    AST node = constants[*ip++];
+    LeaveException(RaiseException, node->value, node->file);
+}
+    JUMP(ip[0]);
+    DISPATCH();
+
+op_break:
+    StatementBreak();
+    JUMP(ip[0]);
+    DISPATCH();
+
+op_return:
+{
+    Value value = *--sp;
+
+    // Nothing returned: only this block is left
+    if (ValueIsNull(value))
+    {
+        JUMP(ip[0]);
+        DISPATCH();
+    }
+
+    // Every block of the call is left
+    if (try != tries)
+        IgnoreException(tries[0]);
+
+    return StatementExit(scopes[0], value);
+}
+
+op_enter:
+    *scope++ = StatementEnter();
+    CHECK();
+    DISPATCH();
+
+op_exit:
+    StatementExit(*--scope, ValueNull());
+    DISPATCH();
+
+op_test:
+{
+    Value condition = *--sp;
+
+    if (ValueIsNull(condition))
+        JUMP(ip[1]);
+    else if (ValueTruthy(condition))
+        ip += 2;
+    else
+        JUMP(ip[0]);
+
+    ValueFree(condition);
+}
+    DISPATCH();
+
+op_while:
+{
+    Value condition = *--sp;
+
+    if (ValueTruthy(condition) && !ErrorLevel() && !StatementBroken())
+        ip++;
+    else
+        JUMP(ip[0]);
+
+    ValueFree(condition);
+}
+    DISPATCH();
+
+op_broken:
+    if (StatementBroken())
+        JUMP(ip[0]);
+    else
+        ip++;
+    DISPATCH();
+
+op_check:
+    CHECK();
+    DISPATCH();
+
+op_jump:
+    JUMP(ip[0]);
+    DISPATCH();
+
+op_try:
+    *try++ = AsIgnoredException();
+    IgnoreException(1);
+    DISPATCH();
+
+op_catch:
+    IgnoreException(*--try);
+
+    if (ErrorLevel() && !StatementBroken())
+    {
+        ClearException();
+        ip++;
+    }
+    else
+        JUMP(ip[0]);
+    DISPATCH();
+
+op_halt:
+    return ValueNull();
+}
@@ -22,34 +22,6 @@
 /* A clean way to write (*tokens) = (*tokens)->next */
 #define __tokens_next() (*tokens) = (*tokens)->next
 
-/**
- * @brief Convert int to string
- *
- * @param number
- * @return char*
- */
-static inline char *__int(int number)
-{
-    // Convert double to string
-    char string[100] = {0};
-    // Duplicate string
-    return strdup(itoa(string, sizeof(string), number));
-}
-
-/**
- * @brief Convert boolean to string
- *
- * @param boolean
- * @return char*
- */
-static inline char *__boolean(char boolean)
-{
-    // Convert char:1 to string
-    char string[2] = {'0' + (boolean && 1), 0};
-    // Duplicate string
-    return strdup(string);
-}
-
 /**
  * @brief Looks up the mathematical priority of an operator
  *
@@ -114,7 +86,8 @@ static AST ParseArray(Tokens **tokens)
  */
 AST ParseValue(Tokens **tokens)
 {
-    Node *value = Branch((*tokens)->value, NODE_ROOT, (*tokens)->file);
+    // Names are atoms: the type is known before the node is created
+    Node *value = Branch((*tokens)->value, (*tokens)->type == TKN_NAME ? NODE_MEMGET : NODE_ROOT, (*tokens)->file);
     Tokens *old = *tokens;
 
     __tokens_next();
@@ -233,220 +206,486 @@ AST ParseExpr(Tokens **tokens, unsigned char priority)
 }
 
 /**
- * @brief Get the Array Index object
+ * @brief Resolve the operator of a NODE_OPERATOR
  *
- * @param array
- * @param size
- * @return long long
+ * @param symbol
+ * @return math_operator
  */
-static long long GetArrayIndex(AST array, size_t size)
+math_operator MathOperator(char *symbol)
 {
-    while (array)
-        if (array->type != NODE_ARRAY)
-            array = array->sibling;
-        else
-            break;
+    switch (*symbol)
+    {
+    case ',':
+        return MATH_CONCAT;
+    case '=':
+        return MATH_EQUAL;
+    case '~':
+    case '!':
+        return MATH_NOT_EQUAL;
+    case '<':
+        return symbol[1] == '=' ? MATH_LESS_EQUAL : MATH_LESS;
+    case '>':
+        return symbol[1] == '=' ? MATH_GREATER_EQUAL : MATH_GREATER;
+    case '&':
+        return MATH_AND;
+    case '|':
+        return MATH_OR;
+    case '^':
+        return MATH_XOR;
+    case '%':
+        return MATH_MODULO;
+    case '*':
+        return MATH_MULTIPLY;
+    case '/':
+        return MATH_DIVIDE;
+    case '+':
+        return MATH_ADD;
+    case '-':
+        return MATH_SUBTRACT;
+    default:
+        return MATH_UNKNOWN;
+    }
+}
 
-    if (!array)
-        return -1;
+/**
+ * @brief Concatenate 2 values
+ *
+ * @param x
+ * @param y
+ * @return Value
+ */
+static Value Concat(Value x, Value y)
+{
+    char bx[VALUE_BUFFER], by[VALUE_BUFFER];
 
-    char *index = Eval(array->child);
+    char *sx = ValueCString(x, bx);
+    char *sy = ValueCString(y, by);
 
-    if (!index)
-        return -1;
+    size_t lx = strlen(sx);
+    size_t ly = strlen(sy);
 
-    int indexlld = atoi(index);
-    indexlld = indexlld < 0 ? (int)size + indexlld : indexlld;
-    free(index);
+    char *result = malloc(lx + ly + 1);
 
-    if (size <= (size_t)indexlld || indexlld < 0)
+    if (result)
     {
-        LeaveException(IndexOutOfRange, array->value, array->file);
-        return -1;
+        memmove(result, sx, lx);
+        memmove(result + lx, sy, ly + 1);
     }
 
-    return indexlld;
+    ValueFree(x);
+    ValueFree(y);
+
+    if (!result)
+        return ValueException(InterpreterError, "OUT OF MEMORY", EmptyDocument());
+
+    return ValueString(result);
 }
 
 /**
- * @brief Array parser
+ * @brief Apply an operator to 2 values (frees x and y)
  *
- * @param value
- * @param array
- * @return char*
+ * @param operator
+ * @param x
+ * @param y
+ * @param tree NODE_OPERATOR (errors)
+ * @return Value
  */
-static char *Array(char *value, AST array)
+Value MathApply(math_operator operator, Value x, Value y, AST tree)
 {
-    if (!value || !array)
-        return value;
+    if (ValueIsNull(x) || ValueIsNull(y))
+    {
+        ValueFree(x);
+        ValueFree(y);
+        return ValueNull();
+    }
 
-    long long index = GetArrayIndex(array, strlen(value));
-    char *result = NULL;
+    unsigned char equal = 0;
 
-    if (index < 0)
-        return value;
+    switch (operator)
+    {
+    case MATH_CONCAT:
+        return Concat(x, y);
+
+    case MATH_EQUAL:
+    case MATH_NOT_EQUAL:
+        equal = ValueEqual(x, y);
+        ValueFree(x);
+        ValueFree(y);
+        return ValueBoolean(operator == MATH_EQUAL ? equal : !equal);
+
+    default:
+        break;
+    }
+
+    int dx = ValueInt(x);
+    int dy = ValueInt(y);
+
+    ValueFree(x);
+    ValueFree(y);
 
-    if (!(result = malloc(2)))
+    if ((operator == MATH_DIVIDE || operator == MATH_MODULO) && !dy)
+        return ValueException(DivideByZero, tree->value, tree->file);
+
+    switch (operator)
     {
-        free(value);
-        return __SOARE_OUT_OF_MEMORY();
+    case MATH_LESS:
+        return ValueBoolean(dx < dy);
+
+    case MATH_LESS_EQUAL:
+        return ValueBoolean(dx <= dy);
+
+    case MATH_GREATER:
+        return ValueBoolean(dx > dy);
+
+    case MATH_GREATER_EQUAL:
+        return ValueBoolean(dx >= dy);
+
+    case MATH_AND:
+        return ValueBoolean(dx && dy);
+
+    case MATH_OR:
+        return ValueBoolean(dx || dy);
+
+    case MATH_XOR:
+        return ValueNumber(dx ^ dy);
+
+    case MATH_MODULO:
+        return ValueNumber(dx % dy);
+
+    case MATH_MULTIPLY:
+        return ValueNumber(dx * dy);
+
+    case MATH_DIVIDE:
+        return ValueNumber(dx / dy);
+
+    case MATH_ADD:
+        return ValueNumber(dx + dy);
+
+    case MATH_SUBTRACT:
+        return ValueNumber(dx - dy);
+
+    default:
+        return ValueException(MathError, tree->value, tree->file);
     }
+}
+
+/**
+ * @brief Check if an assignment only appends to its variable (name = name, x, ...)
+ *
+ * @param memset NODE_MEMSET
+ * @return unsigned char
+ */
+unsigned char MathIsAppend(AST memset)
+{
+    AST tree = memset->child;
 
-    0 [result] = value[index];
-    1 [result] = 0;
+    if (!tree || tree->type != NODE_OPERATOR || MathOperator(tree->value) != MATH_CONCAT)
+        return 0;
 
-    free(value);
-    return result;
+    // Leftmost operand of the chain: (((name, x), y), z)
+    while (tree->type == NODE_OPERATOR && MathOperator(tree->value) == MATH_CONCAT)
+        tree = tree->child;
+
+    return tree->type == NODE_MEMGET && !tree->child && tree->value == memset->value;
 }
 
 /**
- * @brief Evaluates the mathematical expression of a tree
+ * @brief Evaluate the right operands of a concatenation chain, in order
  *
  * @param tree
- * @return char*
+ * @param operands
+ * @return unsigned int Number of operands
  */
-static char *Math(AST tree)
+static unsigned int AppendOperands(AST tree, Value *operands)
 {
-    switch (tree->type)
-    {
-    case NODE_VALUE:
+    unsigned int count = 0;
 
-        return strdup(tree->value);
+    if (tree->child->type == NODE_OPERATOR)
+        count = AppendOperands(tree->child, operands);
 
-    case NODE_CALL:
-
-        return RunFunction(tree);
+    operands[count] = Eval(tree->child->sibling);
+    return count + 1;
+}
 
-    case NODE_MEMGET:
+/**
+ * @brief Assign name = name, x, ... by growing the string of the variable in place
+ *
+ * @param variable
+ * @param memset NODE_MEMSET (see MathIsAppend)
+ */
+void MathAppend(MEM variable, AST memset)
+{
+    if (variable->value.type != VALUE_STRING)
     {
-        MEM get = MemGet(MEMORY, tree->value);
+        MemSet(variable, Eval(memset->child));
+        return;
+    }
 
-        if (!get)
-            return LeaveException(UndefinedReference, tree->value, tree->file);
+    unsigned int count = 0;
+    for (AST tree = memset->child; tree->type == NODE_OPERATOR; tree = tree->child)
+        count++;
 
-        if (get->body)
-            return LeaveException(VariableDefinedAsFunction, tree->value, tree->file);
+    char *string = variable->value.string;
+    size_t length = variable->length != MEM_LENGTH_UNKNOWN ? variable->length : strlen(string);
 
-        return strdup(get->value);
-    }
+    // The operands still read the string (copies), but cannot free it
+    variable->value = ValueReference(string);
 
-    case NODE_OPERATOR:
+    Value operands[count];
+    AppendOperands(memset->child, operands);
+
+    unsigned char failed = 0;
+
+    for (unsigned int i = 0; i < count; i++)
     {
-        char *sx = Eval(tree->child);
-        char *sy = Eval(tree->child->sibling);
+        char buffer[VALUE_BUFFER];
+        char *operand = ValueCString(operands[i], buffer);
 
-        if (!sx || !sy)
+        if (!operand || failed)
         {
-            free(sx);
-            free(sy);
-            return NULL;
+            failed = 1;
+            continue;
         }
 
-        char *result = NULL;
+        size_t size = strlen(operand);
 
-        switch (*(tree->value))
+        // Capacity doubles: n appends copy O(n) bytes
+        if (length + size + 1 > msize(string))
         {
-        case ',':
-            if (!(result = malloc(strlen(sx) + strlen(sy) + 1)))
-                return __SOARE_OUT_OF_MEMORY();
-
-            result[0] = 0;
-            strcat(result, sx);
-            strcat(result, sy);
-            free(sx);
-            free(sy);
-            return result;
-
-        case '=':
-            result = __boolean(!strcmp(sx, sy));
-            free(sx);
-            free(sy);
-            return result;
-
-        case '~':
-        case '!':
-            result = __boolean(strcmp(sx, sy));
-            free(sx);
-            free(sy);
-            return result;
-
-        default:
-            break;
+            size_t capacity = msize(string) * 2;
+            char *grown = realloc(string, capacity > length + size + 1 ? capacity : length + size + 1);
+
+            if (!grown)
+            {
+                LeaveException(InterpreterError, "OUT OF MEMORY", EmptyDocument());
+                failed = 1;
+                continue;
+            }
+
+            string = grown;
         }
 
-        int dx = atoi(sx);
-        int dy = atoi(sy);
+        memmove(string + length, operand, size + 1);
+        length += size;
+    }
 
-        free(sx);
-        free(sy);
+    for (unsigned int i = 0; i < count; i++)
+        ValueFree(operands[i]);
 
-        if ((*(tree->value) == '/' || *(tree->value) == '%') && !dy)
-            return LeaveException(DivideByZero, tree->value, tree->file);
+    // A null operand makes the whole concatenation null
+    if (failed)
+    {
+        free(string);
+        MemSet(variable, ValueNull());
+        return;
+    }
 
-        switch (*(tree->value))
-        {
-        // < or <=
-        case '<':
-            return __boolean(dx < dy || (tree->value[1] == '=' && dx == dy));
+    MemSet(variable, ValueString(string));
+    variable->length = length;
+}
 
-        // > or >=
-        case '>':
-            return __boolean(dx > dy || (tree->value[1] == '=' && dx == dy));
+/**
+ * @brief Strings of one character, shared by every index result
+ *
+ * @param character
+ * @return char*
+ */
+static char *MathCharacter(unsigned char character)
+{
+    static char characters[256][2] = {{0}};
+
+    characters[character][0] = (char)character;
+    return characters[character];
+}
 
-        case '&':
-            return __boolean(dx && dy);
+/**
+ * @brief Character of a string at an index (negative: from the end)
+ *
+ * @param string
+ * @param length
+ * @param index
+ * @param array NODE_ARRAY (errors)
+ * @return Value (VALUE_NULL if index is out of range)
+ */
+static Value MathCharAt(char *string, size_t length, int index, AST array)
+{
+    index = index < 0 ? (int)length + index : index;
 
-        case '|':
-            return __boolean(dx || dy);
+    if (length <= (size_t)index || index < 0)
+        return ValueException(IndexOutOfRange, array->value, array->file);
 
-        case '^':
-            return __int(dx ^ dy);
+    // Borrowed from a static table: no allocation
+    return ValueReference(MathCharacter((unsigned char)string[index]));
+}
 
-        case '%':
-            return __int(dx % dy);
+/**
+ * @brief Index a value (frees value and index)
+ *
+ * @param value
+ * @param index
+ * @param array NODE_ARRAY (errors)
+ * @return Value (value itself if index is NULL, VALUE_NULL if out of range)
+ */
+Value MathIndex(Value value, Value index, AST array)
+{
+    if (ValueIsNull(value) || ValueIsNull(index))
+    {
+        ValueFree(index);
+        return value;
+    }
 
-        case '*':
-            return __int(dx * dy);
+    char buffer[VALUE_BUFFER];
+    char *string = ValueCString(value, buffer);
 
-        case '/':
-            return __int(dx / dy);
+    Value result = MathCharAt(string, strlen(string), ValueInt(index), array);
 
-        case '+':
-            return __int(dx + dy);
+    ValueFree(index);
+    ValueFree(value);
 
-        case '-':
-            return __int(dx - dy);
+    return result;
+}
 
-        default:
-            return LeaveException(MathError, tree->value, tree->file);
-        }
+/**
+ * @brief Read a variable with a subscript (name[index]) without copying it
+ *
+ * @param tree NODE_MEMGET with a NODE_ARRAY child
+ * @return Value
+ */
+Value MathSubscript(AST tree)
+{
+    MEM get = MemGet(MEMORY, tree->value);
+
+    if (!get)
+        return ValueException(UndefinedReference, tree->value, tree->file);
+
+    if (get->body)
+        return ValueException(VariableDefinedAsFunction, tree->value, tree->file);
+
+    AST array = tree->child;
+
+    if (get->value.type != VALUE_STRING && get->value.type != VALUE_REFERENCE)
+        return MathIndex(ValueCopy(get->value), Eval(array->child), array);
+
+    char *string = get->value.string;
+
+    // Measured once, until the variable changes
+    if (get->length == MEM_LENGTH_UNKNOWN)
+        get->length = strlen(string);
+
+    size_t length = get->length;
+
+    // The index still reads the string (copies), but cannot free it
+    unsigned char borrowed = get->value.type == VALUE_STRING;
+    if (borrowed)
+        get->value = ValueReference(string);
+
+    Value index = Eval(array->child);
+    Value result = ValueIsNull(index) ? ValueCopy(ValueReference(string)) : MathCharAt(string, length, ValueInt(index), array);
+
+    ValueFree(index);
+
+    if (borrowed)
+    {
+        // Assigned while the index was evaluated: the string is no longer the variable's
+        if (get->value.type == VALUE_REFERENCE && get->value.string == string)
+            get->value = ValueString(string);
+        else
+            free(string);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Array parser
+ *
+ * @param value
+ * @param array
+ * @return Value
+ */
+static Value Array(Value value, AST array)
+{
+    if (ValueIsNull(value))
+        return value;
+
+    while (array)
+        if (array->type != NODE_ARRAY)
+            array = array->sibling;
+        else
+            break;
+
+    if (!array)
+        return value;
+
+    return MathIndex(value, Eval(array->child), array);
+}
+
+/**
+ * @brief Evaluates the mathematical expression of a tree
+ *
+ * @param tree
+ * @return Value
+ */
+static Value Math(AST tree)
+{
+    switch (tree->type)
+    {
+    case NODE_VALUE:
+
+        // Literals are borrowed from the tree
+        return ValueReference(tree->value);
+
+    case NODE_CALL:
+
+        return RunFunction(tree);
+
+    case NODE_MEMGET:
+    {
+        MEM get = MemGet(MEMORY, tree->value);
+
+        if (!get)
+            return ValueException(UndefinedReference, tree->value, tree->file);
+
+        if (get->body)
+            return ValueException(VariableDefinedAsFunction, tree->value, tree->file);
+
+        return ValueCopy(get->value);
+    }
+
+    case NODE_OPERATOR:
+    {
+        Value x = Eval(tree->child);
+        Value y = Eval(tree->child->sibling);
+
+        return MathApply(MathOperator(tree->value), x, y, tree);
     }
 
     default:
-        return LeaveException(MathError, tree->value, tree->file);
+        return ValueException(MathError, tree->value, tree->file);
     }
 
-    return NULL;
+    return ValueNull();
 }
 
 /**
  * @brief Evaluates the mathematical expression of a tree
  *
  * @param tree
- * @return char*
+ * @return Value
  */
-char *Eval(AST tree)
+Value Eval(AST tree)
 {
     if (!tree)
-        return NULL;
+        return ValueNull();
 
-    char *string = Array(Math(tree), tree->child);
+    // Variables are indexed in place (see MathSubscript)
+    Value value = tree->type == NODE_MEMGET && tree->child ? MathSubscript(tree) : Array(Math(tree), tree->child);
 
     if (ErrorLevel())
     {
-        free(string);
-        return NULL;
+        ValueFree(value);
+        return ValueNull();
     }
 
-    return string;
+    return value;
 }
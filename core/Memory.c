@@ -22,6 +22,81 @@
 // Memory used by the interpreter
 MEM MEMORY = NULL;
 
+/* Number of buckets of the index (power of 2) */
+#define MEMORY_BUCKETS 0x400
+
+// Variables of MEMORY by name hash (newest first)
+static MEM BUCKETS[MEMORY_BUCKETS] = {NULL};
+
+// Last variable of MEMORY
+static MEM TAIL = NULL;
+
+// Version of each bucket, changed when a variable joins or leaves it (never 0)
+static unsigned int VERSIONS[MEMORY_BUCKETS] = {[0 ... MEMORY_BUCKETS - 1] = 1};
+
+// Last version given to a bucket
+static unsigned int CLOCK = 1;
+
+/**
+ * @brief Invalidate what the nodes found in a bucket
+ *
+ * @param bucket
+ */
+static inline void MemTouch(unsigned int bucket)
+{
+    if (!++CLOCK)
+        CLOCK = 1;
+    VERSIONS[bucket] = CLOCK;
+}
+
+/**
+ * @brief Add a variable to the index
+ *
+ * @param memory
+ */
+static void MemIndex(MEM memory)
+{
+    memory->indexed = 1;
+    TAIL = memory;
+
+    if (!memory->name)
+        return;
+
+    MemTouch(memory->hash & (MEMORY_BUCKETS - 1));
+
+    MEM *bucket = &BUCKETS[memory->hash & (MEMORY_BUCKETS - 1)];
+    memory->bucket = *bucket;
+    *bucket = memory;
+}
+
+/**
+ * @brief Remove a variable from the index
+ *
+ * @param memory
+ */
+static void MemUnindex(MEM memory)
+{
+    if (!memory->indexed)
+        return;
+
+    memory->indexed = 0;
+
+    if (!memory->name)
+        return;
+
+    MemTouch(memory->hash & (MEMORY_BUCKETS - 1));
+
+    // Scopes are freed from the end: the variable is almost always first
+    MEM *bucket = &BUCKETS[memory->hash & (MEMORY_BUCKETS - 1)];
+
+    for (; *bucket; bucket = &(*bucket)->bucket)
+        if (*bucket == memory)
+        {
+            *bucket = memory->bucket;
+            break;
+        }
+}
+
 /**
  * @brief Create a new empty memory
  *
@@ -37,7 +112,63 @@ MEM Mem(void)
     memory->name = NULL;
     memory->next = NULL;
     memory->body = NULL;
-    memory->value = NULL;
+    memory->value = ValueNull();
+    memory->length = MEM_LENGTH_UNKNOWN;
+
+    memory->hash = 0;
+    memory->bucket = NULL;
+    memory->indexed = 0;
+
+    memory->slot = 0;
+    memory->spares = 0;
+
+    return memory;
+}
+
+/**
+ * @brief Create an empty memory followed by slots for the next variables pushed (one allocation)
+ *
+ * @param slots
+ * @return MEM
+ */
+MEM MemFrame(unsigned int slots)
+{
+    if (slots > 0xFFFF)
+        return Mem();
+
+    MEM memory = (mem *)malloc((slots + 1) * sizeof(struct mem));
+
+    if (!memory)
+        return __SOARE_OUT_OF_MEMORY();
+
+    memory->name = NULL;
+    memory->next = NULL;
+    memory->body = NULL;
+    memory->value = ValueNull();
+    memory->length = MEM_LENGTH_UNKNOWN;
+
+    memory->hash = 0;
+    memory->bucket = NULL;
+    memory->indexed = 0;
+
+    // The whole block is released with the first memory
+    memory->slot = 0;
+    memory->spares = (unsigned short)slots;
+
+    return memory;
+}
+
+/**
+ * @brief Create the memory used by the interpreter, whose variables are indexed
+ *
+ * @return MEM
+ */
+MEM MemRoot(void)
+{
+    MEM memory = Mem();
+
+    if (memory)
+        MemIndex(memory);
 
     return memory;
 }
@@ -52,40 +183,93 @@ MEM MemLast(MEM memory)
 {
     if (!memory)
         return NULL;
+    if (memory->indexed)
+        return TAIL;
     for (; memory->next; memory = memory->next)
         ;
     return memory;
 }
 
+/**
+ * @brief Link a memory after another one (indexes it if it joins MEMORY)
+ *
+ * @param memory
+ * @param chain
+ */
+void MemAttach(MEM memory, MEM chain)
+{
+    memory->next = chain;
+
+    if (memory->indexed)
+        for (; chain; chain = chain->next)
+            MemIndex(chain);
+}
+
+/**
+ * @brief Free every variable after a memory
+ *
+ * @param memory
+ */
+void MemTruncate(MEM memory)
+{
+    MemFree(memory->next);
+    memory->next = NULL;
+
+    if (memory->indexed)
+        TAIL = memory;
+}
+
 /**
  * @brief Add a variable to an existing memory (free value if memory is NULL or if MemPush fail)
  *
  * @param memory
- * @param name
+ * @param name atom (see Atom)
  * @return MEM
  */
-MEM MemPush(mem *memory, char *name, char *value)
+MEM MemPush(mem *memory, char *name, Value value)
 {
     if (!memory)
     {
-        free(value);
+        ValueFree(value);
         return NULL;
     }
 
     MEM mem = MemLast(memory);
-    mem->next = (MEM)malloc(sizeof(struct mem));
+    unsigned char slot = memory->spares != 0;
+
+    // Slots are used in order: the next one follows the last variable
+    if (slot)
+    {
+        mem->next = mem + 1;
+        memory->spares--;
+    }
+    else
+        mem->next = (MEM)malloc(sizeof(struct mem));
+
     mem = mem->next;
 
     if (!mem)
     {
-        free(value);
+        ValueFree(value);
         return __SOARE_OUT_OF_MEMORY();
     }
 
     mem->next = NULL;
     mem->body = NULL;
     mem->name = name;
-    mem->value = value;
+    // Borrowed strings may not outlive the memory
+    mem->value = ValueOwn(value);
+    mem->length = MEM_LENGTH_UNKNOWN;
+
+    mem->hash = ATOM_HASH(name);
+    mem->bucket = NULL;
+    mem->indexed = 0;
+
+    mem->slot = slot;
+    mem->spares = 0;
+
+    if (memory->indexed)
+        MemIndex(mem);
 
     return mem;
 }
@@ -100,7 +284,7 @@ MEM MemPush(mem *memory, char *name, char *value)
  */
 MEM MemPushf(MEM memory, char *name, AST body)
 {
-    MEM mem = MemPush(memory, name, NULL);
+    MEM mem = MemPush(memory, name, ValueNull());
     if (mem)
         mem->body = body;
     return mem;
@@ -110,20 +294,57 @@ MEM MemPushf(MEM memory, char *name, AST body)
  * @brief Find a variable in the memory
  *
  * @param memory
- * @param name
+ * @param name atom (see Atom)
  * @return MEM
  */
 MEM MemGet(MEM memory, char *name)
 {
     if (!memory)
         return NULL;
-    MEM get = MemGet(memory->next, name);
-    if (!get && memory->name)
-        if (!strcmp(memory->name, name))
-            return memory;
+
+    // The newest variable of a bucket shadows the older ones
+    if (memory->indexed)
+    {
+        MEM get = BUCKETS[ATOM_HASH(name) & (MEMORY_BUCKETS - 1)];
+
+        for (; get; get = get->bucket)
+            if (get->name == name)
+                return get;
+
+        return NULL;
+    }
+
+    MEM get = NULL;
+    for (; memory; memory = memory->next)
+        if (memory->name == name)
+            get = memory;
     return get;
 }
 
+/**
+ * @brief Find a variable in the memory, reusing what the node found last time if its bucket has not changed
+ *
+ * @param memory
+ * @param node
+ * @return MEM
+ */
+MEM MemGetCached(MEM memory, AST node)
+{
+    if (!memory || !memory->indexed)
+        return MemGet(memory, node->value);
+
+    node_cache *cache = &node->cache;
+    unsigned int bucket = ATOM_HASH(node->value) & (MEMORY_BUCKETS - 1);
+
+    if (cache->version == VERSIONS[bucket])
+        return cache->mem;
+
+    cache->mem = MemGet(memory, node->value);
+    cache->version = VERSIONS[bucket];
+
+    return cache->mem;
+}
+
 /**
  * @brief Update a variable (free value if memory is NULL)
  *
@@ -131,16 +352,17 @@ MEM MemGet(MEM memory, char *name)
  * @param name
  * @return MEM
  */
-MEM MemSet(MEM memory, char *value)
+MEM MemSet(MEM memory, Value value)
 {
     if (!memory)
     {
-        free(value);
+        ValueFree(value);
         return NULL;
     }
 
-    free(memory->value);
-    memory->value = value;
+    ValueFree(memory->value);
+    memory->value = ValueOwn(value);
+    memory->length = MEM_LENGTH_UNKNOWN;
     return memory;
 }
 
@@ -185,10 +407,29 @@ void MemLog(MEM memory)
  */
 void MemFree(MEM memory)
 {
-    if (!memory)
-        return;
+    // Variables are freed from the last one: the list is reversed first
+    MEM reversed = NULL;
 
-    MemFree(memory->next);
-    free(memory->value);
-    free(memory);
+    while (memory)
+    {
+        MEM next = memory->next;
+
+        memory->next = reversed;
+        reversed = memory;
+        memory = next;
+    }
+
+    while (reversed)
+    {
+        MEM next = reversed->next;
+
+        MemUnindex(reversed);
+        ValueFree(reversed->value);
+
+        // Slots are released with their frame (which comes after them)
+        if (!reversed->slot)
+            free(reversed);
+
+        reversed = next;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Optimizer.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+/**
+ * @brief Check if a node is a literal (a value without index)
+ *
+ * @param tree
+ * @return unsigned char
+ */
+static unsigned char OptimizeIsConstant(AST tree)
+{
+    return tree && tree->type == NODE_VALUE && tree->value && !tree->child;
+}
+
+/**
+ * @brief Replace an operation on 2 literals with its result
+ *
+ * @param tree NODE_OPERATOR
+ */
+static void OptimizeFold(AST tree)
+{
+    AST x = tree->child;
+    AST y = x ? x->sibling : NULL;
+
+    if (!OptimizeIsConstant(x) || !OptimizeIsConstant(y))
+        return;
+
+    math_operator operator = MathOperator(tree->value);
+
+    // Errors are raised when the program runs
+    if (operator == MATH_UNKNOWN)
+        return;
+
+    if ((operator == MATH_DIVIDE || operator == MATH_MODULO) && !atoi(y->value))
+        return;
+
+    Value value = MathApply(operator, ValueReference(x->value), ValueReference(y->value), tree);
+
+    if (ErrorLevel())
+    {
+        ValueFree(value);
+        return;
+    }
+
+    char buffer[VALUE_BUFFER];
+    char *string = ArenaStrdup(ValueCString(value, buffer));
+
+    ValueFree(value);
+
+    if (!string)
+        return;
+
+    // Trees built without arena own their nodes
+    TreeFree(tree->child);
+    if (!ARENA)
+        free(tree->value);
+
+    tree->type = NODE_VALUE;
+    tree->value = string;
+    tree->child = NULL;
+    tree->last = NULL;
+}
+
+/**
+ * @brief Simplify the branches of a condition (if/or/else)
+ *
+ * @param tree NODE_CONDITION
+ */
+static void OptimizeCondition(AST tree)
+{
+    AST *link = &tree->child;
+    AST last = NULL;
+
+    while (*link)
+    {
+        AST condition = *link;
+        AST body = condition->sibling;
+
+        Optimize(condition);
+        Optimize(body);
+
+        if (!body || !OptimizeIsConstant(condition))
+        {
+            last = body ? body : condition;
+            link = &last->sibling;
+            continue;
+        }
+
+        // Constant true (else): the next branches are never reached
+        if (ValueTruthy(ValueReference(condition->value)))
+        {
+            condition->type = NODE_ELSE;
+
+            TreeFree(body->sibling);
+            body->sibling = NULL;
+            tree->last = body;
+            return;
+        }
+
+        // Constant false: the branch is never taken
+        *link = body->sibling;
+
+        body->sibling = NULL;
+        TreeFree(condition);
+    }
+
+    tree->last = last;
+}
+
+/**
+ * @brief Simplify a tree before it runs
+ *
+ * @param tree
+ */
+void Optimize(AST tree)
+{
+    if (!tree)
+        return;
+
+    if (tree->type == NODE_CONDITION)
+    {
+        OptimizeCondition(tree);
+        return;
+    }
+
+    AST *link = &tree->child;
+    AST last = NULL;
+
+    while (*link)
+    {
+        AST child = *link;
+
+        Optimize(child);
+
+        // Every branch was removed: the statement does nothing
+        if (child->type == NODE_CONDITION && !child->child)
+        {
+            *link = child->sibling;
+
+            child->sibling = NULL;
+            TreeFree(child);
+            continue;
+        }
+
+        last = child;
+        link = &child->sibling;
+    }
+
+    tree->last = last;
+
+    if (tree->type == NODE_OPERATOR)
+        OptimizeFold(tree);
+}
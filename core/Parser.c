@@ -56,28 +56,58 @@
  *
  */
 
+/**
+ * @brief Check if the nodes of a type are named by an atom (variable, function or keyword)
+ *
+ * @param type
+ * @return unsigned char
+ */
+static inline unsigned char BranchNamed(node_type type)
+{
+    switch (type)
+    {
+    case NODE_CALL:
+    case NODE_FUNCTION:
+    case NODE_MEMNEW:
+    case NODE_MEMGET:
+    case NODE_MEMSET:
+    case NODE_CUSTOM_KEYWORD:
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+
 /**
  * @brief Create a new node
  *
- * @param value
+ * @param value atom if the node names a variable, a function or a keyword
  * @param type
  * @param file
  * @return Node*
  */
 Node *Branch(char *value, node_type type, Document file)
 {
-    Node *branch = (Node *)malloc(sizeof(Node));
+    Node *branch = (Node *)ArenaMalloc(sizeof(Node));
 
     if (!branch)
         return __SOARE_OUT_OF_MEMORY();
 
-    branch->value = !value ? NULL : strdup(value);
+    // Names are atoms (see Tokenizer), other values are copied
+    branch->value = !value || BranchNamed(type) ? value : ArenaStrdup(value);
     branch->type = type;
     branch->file = file;
     branch->parent = NULL;
     branch->child = NULL;
     branch->sibling = NULL;
 
+    // Clears last and code too (see Node)
+    branch->cache.mem = NULL;
+    branch->cache.version = 0;
+    branch->exec = NULL;
+    branch->native = NULL;
+
     return branch;
 }
 
@@ -129,6 +159,9 @@ AST BranchJuxtapose(Node *source, AST element)
     element->parent = source->parent;
     element->sibling = tmp;
 
+    if (!tmp && source->parent)
+        source->parent->last = element;
+
     return source;
 }
 
@@ -171,17 +204,18 @@ AST BranchJoin(Node *parent, Node *child)
      *
      */
 
+    // The last child is kept: statements are added in constant time
     if (parent->child)
-    {
-        Node *tmp = parent->child;
-        while (tmp->sibling)
-            tmp = tmp->sibling;
-        tmp->sibling = child;
-    }
+        parent->last->sibling = child;
     else
         parent->child = child;
 
     child->parent = parent;
+
+    // The child may bring its own siblings
+    for (parent->last = child; parent->last->sibling; parent->last = parent->last->sibling)
+        ;
+
     return parent;
 }
 
@@ -192,13 +226,173 @@ AST BranchJoin(Node *parent, Node *child)
  */
 void TreeFree(AST tree)
 {
-    if (!tree)
+    // Trees built in an arena are released with it
+    if (!tree || ARENA)
         return;
 
-    TreeFree(tree->child);
-    TreeFree(tree->sibling);
-    free(tree->value);
-    free(tree);
+    while (tree)
+    {
+        AST child = tree->child;
+
+        // The children are freed after the node, before its siblings
+        if (child)
+        {
+            AST last = child;
+            for (; last->sibling; last = last->sibling)
+                ;
+
+            last->sibling = tree->sibling;
+            tree->sibling = child;
+        }
+
+        AST next = tree->sibling;
+
+        if (!BranchNamed(tree->type))
+            free(tree->value);
+        free(tree);
+
+        tree = next;
+    }
+}
+
+/**
+ * @brief Nodes and values of a flattened tree (see TreeFlatten)
+ */
+typedef struct flat
+{
+
+    // Next free node of the block
+    Node *next;
+
+    // Values already copied (open addressing, NULL: empty)
+    char **values;
+    // Size of values (power of 2)
+    size_t size;
+
+} Flat;
+
+/**
+ * @brief Count the nodes of a tree (siblings included)
+ *
+ * @param tree
+ * @return size_t
+ */
+static size_t TreeCount(AST tree)
+{
+    size_t count = 0;
+
+    for (; tree; tree = tree->sibling)
+        count += 1 + TreeCount(tree->child);
+
+    return count;
+}
+
+/**
+ * @brief Copy a value once per tree (FNV-1a)
+ *
+ * @param flat
+ * @param value
+ * @return char*
+ */
+static char *TreeValue(Flat *flat, char *value)
+{
+    if (!value)
+        return NULL;
+
+    unsigned int hash = 0x811C9DC5;
+
+    for (char *c = value; *c; c++)
+        hash = (hash ^ (unsigned char)*c) * 0x01000193;
+
+    size_t slot = hash & (flat->size - 1);
+
+    for (; flat->values[slot]; slot = (slot + 1) & (flat->size - 1))
+        if (!strcmp(flat->values[slot], value))
+            return flat->values[slot];
+
+    return flat->values[slot] = ArenaStrdup(value);
+}
+
+/**
+ * @brief Copy a list of siblings and their children, depth-first
+ *
+ * @param flat
+ * @param tree
+ * @param parent
+ * @return Node* (copy of tree)
+ */
+static Node *TreeCopy(Flat *flat, AST tree, Node *parent)
+{
+    Node *first = NULL;
+    Node *previous = NULL;
+
+    for (; tree; tree = tree->sibling)
+    {
+        Node *node = flat->next++;
+
+        *node = *tree;
+        node->value = BranchNamed(tree->type) ? tree->value : TreeValue(flat, tree->value);
+        node->parent = parent;
+        node->sibling = NULL;
+
+        // The last child is only needed while parsing
+        node->cache.mem = NULL;
+        node->cache.version = 0;
+        node->exec = NULL;
+        node->native = NULL;
+
+        // The children follow their parent in the block
+        node->child = TreeCopy(flat, tree->child, node);
+
+        if (previous)
+            previous->sibling = node;
+        else
+            first = node;
+
+        previous = node;
+    }
+
+    return first;
+}
+
+/**
+ * @brief Copy a tree into one block of the current arena
+ *
+ * Nodes are stored depth-first (a node, its children, then its siblings)
+ * and equal values are shared.
+ *
+ * @param tree
+ * @return AST (NULL if there is not enough memory)
+ */
+AST TreeFlatten(AST tree)
+{
+    // Trees built without arena own each node
+    if (!tree || !ARENA)
+        return tree;
+
+    size_t count = TreeCount(tree);
+
+    Flat flat = {NULL, NULL, 16};
+
+    while (flat.size < count * 2)
+        flat.size <<= 1;
+
+    flat.next = (Node *)ArenaMalloc(count * sizeof(Node));
+    flat.values = (char **)malloc(flat.size * sizeof(char *));
+
+    if (!flat.next || !flat.values)
+    {
+        free(flat.values);
+        return __SOARE_OUT_OF_MEMORY();
+    }
+
+    for (size_t i = 0; i < flat.size; i++)
+        flat.values[i] = NULL;
+
+    AST root = TreeCopy(&flat, tree, NULL);
+
+    free(flat.values);
+    return root;
 }
 
 #ifdef __SOARE_DEBUG
@@ -229,7 +423,7 @@ void TreeLog(AST tree)
         soare_write(
             //
             __soare_stdout,
-            "[%s:%.5lld:%.5lld, %.2X, \"%s\"]\t",
+            "[%s:%.5u:%.5u, %.2X, \"%s\"]\t",
             tree->parent->file.file,
             tree->parent->file.ln,
             tree->parent->file.col,
@@ -240,7 +434,7 @@ void TreeLog(AST tree)
     soare_write(
         //
         __soare_stdout,
-        "[%s:%.5lld:%.5lld, %.2X, \"%s\"]\n",
+        "[%s:%.5u:%.5u, %.2X, \"%s\"]\n",
         tree->file.file,
         tree->file.ln,
         tree->file.col,
@@ -280,7 +474,9 @@ AST Parse(Tokens *tokens)
 
         case TKN_KEYWORD:
 
-            if (!strcmp(old->value, KEYWORD_FN))
+            switch (old->keyword)
+            {
+            case KW_FN:
             {
                 if (!TokensFollowPattern(tokens, 2, TKN_NAME, TKN_PARENL))
                 {
@@ -326,8 +522,9 @@ AST Parse(Tokens *tokens)
                 tokens = tokens->next;
                 curr = body;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_BREAK))
+            case KW_BREAK:
             {
                 /**
                  *
@@ -337,8 +534,9 @@ AST Parse(Tokens *tokens)
                  */
                 BranchJoin(curr, Branch(NULL, NODE_BREAK, old->file));
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_LET))
+            case KW_LET:
             {
                 if (!TokensFollowPattern(tokens, 2, TKN_NAME, TKN_ASSIGN))
                 {
@@ -365,8 +563,9 @@ AST Parse(Tokens *tokens)
 
                 BranchJoin(curr, BranchJoin(Branch(old->next->value, NODE_MEMNEW, old->file), content));
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_RETURN))
+            case KW_RETURN:
             {
 
                 /**
@@ -379,8 +578,10 @@ AST Parse(Tokens *tokens)
 
                 BranchJoin(curr, BranchJoin(Branch(NULL, NODE_RETURN, old->file), ParseExpr(&tokens, 0xF)));
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_RAISE) || !strcmp(old->value, KEYWORD_LOADIMPORT))
+            case KW_RAISE:
+            case KW_LOADIMPORT:
             {
                 if (tokens->type != TKN_STRING)
                 {
@@ -398,14 +599,13 @@ AST Parse(Tokens *tokens)
                  */
 
                 // Please note that `raise` and `loadimport` have the same structure
-                // If you changed KEYWORD_RAISE or KEYWORD_LOADIMPORT, please use :
-                // !strcmp(old->value, KEYWORD_RAISE) ? NODE_RAISE : NODE_IMPORT;
-                node_type type = *(old->value) == KEYWORD_RAISE[0] ? NODE_RAISE : NODE_IMPORT;
+                node_type type = old->keyword == KW_RAISE ? NODE_RAISE : NODE_IMPORT;
                 BranchJoin(curr, Branch(tokens->value, type, old->file));
                 tokens = tokens->next;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_TRY))
+            case KW_TRY:
             {
                 Node *try = Branch(NULL, NODE_TRY, old->file);
                 BranchJoin(try, Branch(NULL, NODE_BODY, old->file));
@@ -421,8 +621,9 @@ AST Parse(Tokens *tokens)
 
                 curr = try->child;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_IFERROR))
+            case KW_IFERROR:
             {
                 if (curr == root || curr->parent->type != NODE_TRY || curr->type == NODE_IFERROR)
                 {
@@ -442,8 +643,10 @@ AST Parse(Tokens *tokens)
                 BranchJoin(curr->parent, iferror);
                 curr = iferror;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_IF) || !strcmp(old->value, KEYWORD_WHILE))
+            case KW_IF:
+            case KW_WHILE:
             {
                 AST condition = ParseExpr(&tokens, 0xF);
 
@@ -453,7 +656,7 @@ AST Parse(Tokens *tokens)
                     return LeaveException(ValueError, old->value, old->file);
                 }
 
-                if (tokens->type != TKN_KEYWORD || strcmp(tokens->value, "do"))
+                if (tokens->keyword != KW_DO)
                 {
                     TreeFree(root);
                     return LeaveException(SyntaxError, old->value, old->file);
@@ -470,9 +673,7 @@ AST Parse(Tokens *tokens)
                  */
 
                 // Please note that `if` and `while` have the same structure
-                // If you changed KEYWORD_WHILE or KEYWORD_IF, please use :
-                // !strcmp(old->value, KEYWORD_IF) ? NODE_CONDITION : NODE_REPETITION;
-                node_type type = *(old->value) == KEYWORD_IF[0] ? NODE_CONDITION : NODE_REPETITION;
+                node_type type = old->keyword == KW_IF ? NODE_CONDITION : NODE_REPETITION;
                 AST statement = Branch(NULL, type, old->file);
                 AST body = Branch(NULL, NODE_BODY, old->file);
 
@@ -483,8 +684,9 @@ AST Parse(Tokens *tokens)
                 curr = body;
                 tokens = tokens->next;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_OR))
+            case KW_OR:
             {
                 if (curr->parent->type != NODE_CONDITION)
                 {
@@ -500,7 +702,7 @@ AST Parse(Tokens *tokens)
                     return LeaveException(ValueError, old->value, old->file);
                 }
 
-                if (tokens->type != TKN_KEYWORD || strcmp(tokens->value, "do"))
+                if (tokens->keyword != KW_DO)
                 {
                     TreeFree(root);
                     return LeaveException(SyntaxError, old->value, old->file);
@@ -524,8 +726,9 @@ AST Parse(Tokens *tokens)
                 curr = body;
                 tokens = tokens->next;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_ELSE))
+            case KW_ELSE:
             {
                 if (curr->parent->type != NODE_CONDITION)
                 {
@@ -550,8 +753,9 @@ AST Parse(Tokens *tokens)
 
                 curr = body;
             }
+            break;
 
-            else if (!strcmp(old->value, KEYWORD_END))
+            case KW_END:
             {
                 if (curr == root)
                 {
@@ -561,11 +765,12 @@ AST Parse(Tokens *tokens)
 
                 curr = curr->parent->parent;
             }
+            break;
 
-            else
-            {
+            default:
                 // Custom keyword
                 BranchJoin(curr, Branch(old->value, NODE_CUSTOM_KEYWORD, old->file));
+                break;
             }
 
             break;
@@ -23,16 +23,20 @@
 
 static MEM FUNCTION = NULL;
 
+static unsigned char broken = 0;
+
+// Engine used by Execute
+static soare_engine ENGINE = ENGINE_BYTECODE;
+
 /**
  * @brief Exit current statement #Runtime(AST)
  *
  * @param returns
- * @return char*
+ * @return Value
  */
-static char *ExitStatement(MEM statement, char *returns)
+static Value ExitStatement(MEM statement, Value returns)
 {
-    MemFree(statement->next);
-    statement->next = NULL;
+    MemTruncate(statement);
     return returns;
 }
 
@@ -42,53 +46,150 @@ static char *ExitStatement(MEM statement, char *returns)
  * @param error
  * @param string
  * @param file
- * @return void*
+ * @return Value
+ */
+static Value ExitStatementError(MEM statement, SoareExceptions error, char *string, Document file)
+{
+    return ExitStatement(statement, ValueException(error, string, file));
+}
+
+/**
+ * @brief Open a statement: a scope at the end of MEMORY, holding the pending function arguments
+ *
+ * @return MEM
+ */
+MEM StatementEnter(void)
+{
+    MEM statement = MemLast(MEMORY);
+    MemAttach(statement, FUNCTION);
+    FUNCTION = NULL;
+
+    broken = 0;
+
+    return statement;
+}
+
+/**
+ * @brief Close a statement (frees its scope)
+ *
+ * @param statement
+ * @param returns
+ * @return Value
  */
-static void *ExitStatementError(MEM statement, SoareExceptions error, char *string, Document file)
+Value StatementExit(MEM statement, Value returns)
 {
-    return ExitStatement(statement, LeaveException(error, string, file));
+    return ExitStatement(statement, returns);
+}
+
+/**
+ * @brief Break out of the current loop
+ *
+ */
+void StatementBreak(void)
+{
+    broken = 1;
+}
+
+/**
+ * @brief Check if a break is pending
+ *
+ * @return unsigned char
+ */
+unsigned char StatementBroken(void)
+{
+    return broken;
 }
 
 /**
  * @brief Executes code from a tree
  *
  * @param tree
- * @return char*
+ * @return Value
  */
-static char *Runtime(AST tree);
+static Value Runtime(AST tree);
+
+/**
+ * @brief Execute a predefined function
+ *
+ * @param tree
+ * @return Value
+ */
+static Value RunNative(AST tree)
+{
+    // A trailing NODE_ARRAY is the index of the result, not an argument
+    unsigned int argc = 0;
+    for (AST arg = tree->child; arg && arg->type != NODE_ARRAY; arg = arg->sibling)
+        argc++;
+
+    // Each argument is evaluated once, in order, for both conventions
+    char *argv[argc + 1];
+    AST arg = tree->child;
+
+    for (unsigned int i = 0; i < argc; i++, arg = arg->sibling)
+        argv[i] = ValueRelease(Eval(arg));
+    argv[argc] = NULL;
+
+    char *result = NULL;
+
+    if (tree->exec)
+    {
+        // Added with soare_addfunction: arguments are read with soare_getarg
+        struct soare_arguments args = {argc, argv};
+        result = tree->exec(&args);
+    }
+    else
+        // Added with soare_addnative
+        result = tree->native(argc, argv);
+
+    for (unsigned int i = 0; i < argc; i++)
+        free(argv[i]);
+
+    return ValueString(result);
+}
 
 /**
  * @brief Execute a function
  *
  * @param tree
- * @return char*
+ * @return Value
  */
-char *RunFunction(AST tree)
+Value RunFunction(AST tree)
 {
-    // Get the memory
-    MEM get = MemGet(MEMORY, tree->value);
+    // Get the memory (resolved again only if its bucket changed)
+    MEM get = MemGetCached(MEMORY, tree);
 
     // Memory not found
     if (!get)
     {
-        // Predefined functions
-        soare_function soare_fn = soare_getfunction(tree->value);
+        // Predefined functions (the registry only grows: the pointers stay valid)
+        if (!tree->exec && !tree->native)
+        {
+            soare_function soare_fn = soare_getfunction(tree->value);
+            tree->exec = soare_fn.exec;
+            tree->native = soare_fn.native;
+        }
 
-        if (soare_fn.name)
-            return soare_fn.exec(tree->child);
+        if (tree->exec || tree->native)
+            return RunNative(tree);
 
         // Function is not defined
-        return LeaveException(UndefinedReference, tree->value, tree->file);
+        return ValueException(UndefinedReference, tree->value, tree->file);
     }
 
     // Memory is not a function
     if (!get->body)
-        return LeaveException(ObjectIsNotCallable, tree->value, tree->file);
+        return ValueException(ObjectIsNotCallable, tree->value, tree->file);
 
     // Arguments
     AST ptr = get->body->child;
     AST src = tree->child;
-    MEM memf = Mem();
+
+    // One allocation for the frame and its parameters
+    unsigned int parameters = 0;
+    for (AST param = ptr; param && param->type != NODE_BODY; param = param->sibling)
+        parameters++;
+
+    MEM memf = MemFrame(parameters);
 
     AST func = NULL;
 
@@ -98,7 +199,8 @@ char *RunFunction(AST tree)
         if (ptr->type == NODE_BODY)
         {
             FUNCTION = memf;
-            return Runtime(ptr);
+            // Bodies compiled by Execute run on the bytecode machine
+            return ptr->code && ENGINE == ENGINE_BYTECODE ? Machine(ptr->code) : Runtime(ptr);
         }
 
         // Not enough argument
@@ -106,7 +208,7 @@ char *RunFunction(AST tree)
         {
             MemFree(memf);
             memf = NULL;
-            return LeaveException(UndefinedReference, ptr->value, tree->file);
+            return ValueException(UndefinedReference, ptr->value, tree->file);
         }
 
         get = NULL;
@@ -114,7 +216,7 @@ char *RunFunction(AST tree)
         // If it is a reference to a memory
         if (src->type == NODE_MEMGET)
             // If memory exists
-            if ((get = MemGet(MEMORY, src->value)))
+            if ((get = MemGetCached(MEMORY, src)))
                 // If memory is a function
                 if ((func = get->body))
                     // Add this function in argument
@@ -129,27 +231,21 @@ char *RunFunction(AST tree)
         ptr = ptr->sibling;
     }
 
-    return NULL;
+    return ValueNull();
 }
 
-static unsigned char broken = 0;
-
 /**
  * @brief Interprets an AST node tree
  *
  * @param tree
- * @return char*
+ * @return Value
  */
-static char *Runtime(AST tree)
+static Value Runtime(AST tree)
 {
     if (!tree)
-        return NULL;
-
-    MEM statement = MemLast(MEMORY);
-    statement->next = FUNCTION;
-    FUNCTION = NULL;
+        return ValueNull();
 
-    broken = 0;
+    MEM statement = StatementEnter();
 
     for (AST curr = tree->child; curr && !ErrorLevel(); curr = curr->sibling)
     {
@@ -162,13 +258,13 @@ static char *Runtime(AST tree)
 
         case NODE_CALL:
             // Execute function call and free result
-            free(RunFunction(curr));
+            ValueFree(RunFunction(curr));
             break;
 
         case NODE_BREAK:
             // Break out of loop
-            broken = 1;
-            return ExitStatement(statement, NULL);
+            StatementBreak();
+            return ExitStatement(statement, ValueNull());
 
         case NODE_RETURN:
             // Return from function
@@ -197,7 +293,11 @@ static char *Runtime(AST tree)
             if (get->body)
                 return ExitStatementError(statement, VariableDefinedAsFunction, curr->value, curr->file);
 
-            MemSet(get, Eval(curr->child));
+            // name = name, x: the string grows in place
+            if (MathIsAppend(curr))
+                MathAppend(get, curr);
+            else
+                MemSet(get, Eval(curr->child));
         }
         break;
 
@@ -213,29 +313,26 @@ static char *Runtime(AST tree)
         case NODE_CONDITION:
         {
             // Evaluate condition chain (if/or/else)
-            AST tmp = curr->child;
-            char *condition = Eval(tmp);
-
-            while (condition)
+            for (AST tmp = curr->child; tmp; tmp = tmp->sibling ? tmp->sibling->sibling : NULL)
             {
-                if (strcmp(condition, "0"))
+                // Else branches are not evaluated (see Optimize)
+                Value condition = tmp->type == NODE_ELSE ? ValueBoolean(1) : Eval(tmp);
+
+                if (ValueIsNull(condition))
+                    break;
+
+                if (ValueTruthy(condition))
                 {
-                    free(condition);
+                    ValueFree(condition);
 
-                    char *value = Runtime(tmp->sibling);
+                    Value value = Runtime(tmp->sibling);
 
-                    if (value || broken)
+                    if (!ValueIsNull(value) || broken)
                         return ExitStatement(statement, value);
                     break;
                 }
 
-                free(condition);
-
-                if (!tmp->sibling)
-                    break;
-
-                tmp = tmp->sibling->sibling;
-                condition = Eval(tmp);
+                ValueFree(condition);
             }
         }
         break;
@@ -243,21 +340,21 @@ static char *Runtime(AST tree)
         case NODE_REPETITION:
         {
             // Loop while condition is true (!= "0")
-            char *condition = Eval(curr->child);
+            Value condition = Eval(curr->child);
 
-            while (condition && strcmp(condition, "0") && !ErrorLevel() && !broken)
+            while (ValueTruthy(condition) && !ErrorLevel() && !broken)
             {
-                free(condition);
+                ValueFree(condition);
 
-                char *value = Runtime(curr->child->sibling);
+                Value value = Runtime(curr->child->sibling);
 
-                if (value)
+                if (!ValueIsNull(value))
                     return ExitStatement(statement, value);
 
                 condition = Eval(curr->child);
             }
 
-            free(condition);
+            ValueFree(condition);
         }
         break;
 
@@ -266,17 +363,17 @@ static char *Runtime(AST tree)
             // try/iferror block
             unsigned char previous = AsIgnoredException();
             IgnoreException(1);
-            char *value = Runtime(curr->child);
+            Value value = Runtime(curr->child);
             IgnoreException(previous);
 
             if (ErrorLevel() && !broken)
             {
-                free(value);
+                ValueFree(value);
                 ClearException();
                 value = Runtime(curr->child->sibling);
             }
 
-            if (value || broken)
+            if (!ValueIsNull(value) || broken)
                 return ExitStatement(statement, value);
         }
         break;
@@ -287,7 +384,7 @@ static char *Runtime(AST tree)
     }
 
     // Free scope and return
-    return ExitStatement(statement, NULL);
+    return ExitStatement(statement, ValueNull());
 }
 
 /**
@@ -297,7 +394,7 @@ static char *Runtime(AST tree)
 void soare_init(void)
 {
     if (!MEMORY)
-        MEMORY = Mem();
+        MEMORY = MemRoot();
 }
 
 /**
@@ -310,6 +407,26 @@ void soare_kill(void)
     MEMORY = NULL;
 }
 
+/**
+ * @brief Select the engine used by Execute
+ *
+ * @param engine
+ */
+void soare_setengine(soare_engine engine)
+{
+    ENGINE = engine;
+}
+
+/**
+ * @brief Engine used by Execute
+ *
+ * @return soare_engine
+ */
+soare_engine soare_getengine(void)
+{
+    return ENGINE;
+}
+
 /**
  * @brief Execute SOARE code
  *
@@ -322,25 +439,68 @@ char *Execute(char *__restrict__ file, char *__restrict__ rawcode)
     // Clear interpreter exception
     ClearException();
 
-    // Interpretation step 1: Tokenizer
-    Tokens *tokens = Tokenizer(file, rawcode);
-    // Interpretation step 2: Parser
-    AST ast = Parse(tokens);
+    // Nothing to run (an argument without value)
+    if (!rawcode)
+        return NULL;
+
+    Arena *previous = ARENA;
+
+    // Programs already parsed are reused
+    Program *program = CacheGet(file, rawcode);
+    Program parsed = {0};
+
+    if (!program)
+    {
+        // Tokens and the parsed tree are allocated in a temporary arena,
+        // the flattened tree in the arena of the program
+        Arena tokens_arena = {NULL};
+
+        ARENA = &parsed.arena;
+        parsed.file = ArenaStrdup(file);
+        parsed.code = ArenaStrdup(rawcode);
+
+        // Interpretation step 1: Tokenizer
+        ARENA = &tokens_arena;
+        Tokens *tokens = Tokenizer(parsed.file, rawcode);
+
+        // Interpretation step 2: Parser
+        AST tree = Parse(tokens);
+
+        // Interpretation step 3: Optimizer
+        Optimize(tree);
+
+        // Nodes are laid out in the order they run
+        ARENA = &parsed.arena;
+        parsed.ast = TreeFlatten(tree);
+
+        ARENA = previous;
 
 #ifdef __SOARE_DEBUG
-    // DEBUG: print tokens and trees
-    TokensLog(tokens);
-    TreeLog(ast);
+        // DEBUG: print tokens and trees
+        TokensLog(tokens);
+        TreeLog(parsed.ast);
 #endif
 
-    // Free tokens
-    TokensFree(tokens);
+        ArenaFree(&tokens_arena);
+
+        // Programs with errors are parsed (and reported) again
+        program = ErrorLevel() || !parsed.code ? &parsed : CacheStore(&parsed);
+    }
+
+    // Interpretation step 4: Compiler (bytecode)
+    if (ENGINE == ENGINE_BYTECODE && program->ast && !program->chunk)
+    {
+        ARENA = &program->arena;
+        program->chunk = Compile(program->ast);
+        ARENA = previous;
+    }
 
-    // Interpretation step 3: Runtime
-    char *value = Runtime(ast);
+    // Interpretation step 5: Runtime (the result may borrow from the tree)
+    Value value = ENGINE == ENGINE_BYTECODE && program->chunk ? Machine(program->chunk) : Runtime(program->ast);
+    char *string = ValueRelease(value);
 
-    // Free AST
-    TreeFree(ast);
+    // Unpin the program (released if it is not cached)
+    CacheRelease(program);
 
-    return value;
+    return string;
 }
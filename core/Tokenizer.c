@@ -19,6 +19,75 @@
 
 #include <SOARE/SOARE.h>
 
+/* Character classes (CHARACTERS) */
+#define CHR_SPACE 0x01
+#define CHR_ALPHA 0x02
+#define CHR_NUM 0x04
+#define CHR_QUOTE 0x08
+
+/**
+ * @brief Class of each character
+ */
+static const unsigned char CHARACTERS[256] = {
+
+    [' '] = CHR_SPACE,
+    ['\t'] = CHR_SPACE,
+    ['\r'] = CHR_SPACE,
+    ['\n'] = CHR_SPACE,
+
+    ['a' ... 'z'] = CHR_ALPHA,
+    ['A' ... 'Z'] = CHR_ALPHA,
+    ['_'] = CHR_ALPHA,
+
+    ['0' ... '9'] = CHR_NUM,
+    ['.'] = CHR_NUM,
+
+    ['"'] = CHR_QUOTE,
+    ['\''] = CHR_QUOTE,
+    ['`'] = CHR_QUOTE,
+
+};
+
+/**
+ * @brief Token made of a single character (TKN_EOF: none)
+ */
+static const token_type PUNCTUATION[256] = {
+
+    ['='] = TKN_ASSIGN,
+    ['('] = TKN_PARENL,
+    [')'] = TKN_PARENR,
+    ['['] = TKN_ARRAYL,
+    [']'] = TKN_ARRAYR,
+    [';'] = TKN_SEMICOLON,
+
+    ['<'] = TKN_OPERATOR,
+    [','] = TKN_OPERATOR,
+    ['+'] = TKN_OPERATOR,
+    ['-'] = TKN_OPERATOR,
+    ['^'] = TKN_OPERATOR,
+    ['*'] = TKN_OPERATOR,
+    ['/'] = TKN_OPERATOR,
+    ['%'] = TKN_OPERATOR,
+    ['>'] = TKN_OPERATOR,
+
+};
+
+/**
+ * @brief Second character of the operators of 2 characters (==, <=, >=, !=, ~=, &&, ||)
+ */
+static const char OPERATORS[256] = {
+
+    ['='] = '=',
+    ['<'] = '=',
+    ['>'] = '=',
+    ['!'] = '=',
+    // Same as !=
+    ['~'] = '=',
+    ['&'] = '&',
+    ['|'] = '|',
+
+};
+
 /**
  * @brief Check if a character is a number
  *
@@ -28,7 +97,7 @@
  */
 static inline unsigned char chrNum(const char character)
 {
-    return (character >= '0' && character <= '9') || character == '.';
+    return CHARACTERS[(unsigned char)character] & CHR_NUM;
 }
 
 /**
@@ -39,9 +108,7 @@ static inline unsigned char chrNum(const char character)
  */
 static inline unsigned char chrAlpha_(const char character)
 {
-    return ((character >= 'a' && character <= 'z') ||
-            (character >= 'A' && character <= 'Z') ||
-            character == '_');
+    return CHARACTERS[(unsigned char)character] & CHR_ALPHA;
 }
 
 /**
@@ -52,7 +119,7 @@ static inline unsigned char chrAlpha_(const char character)
  */
 static inline unsigned char chrAlnum_(const char character)
 {
-    return chrAlpha_(character) || chrNum(character);
+    return CHARACTERS[(unsigned char)character] & (CHR_ALPHA | CHR_NUM);
 }
 
 /**
@@ -63,81 +130,73 @@ static inline unsigned char chrAlnum_(const char character)
  */
 static inline unsigned char chrSpace(const char character)
 {
-    return (character == ' ' || character == '\t' ||
-            character == '\r' || character == '\n');
+    return CHARACTERS[(unsigned char)character] & CHR_SPACE;
 }
 
 /**
- * @brief Check if the character is an operator
+ * @brief Check if the string starts with an operator of 2 characters
  *
  * @param string
  * @return unsigned char
  */
-static inline unsigned char chrOperator(const char character)
+static inline unsigned char strOperator(const char *string)
 {
-    return strchr("<,+-^*/%>", character) != NULL;
+    char second = OPERATORS[(unsigned char)string[0]];
+    return second && string[1] == second;
 }
 
 /**
- * @brief Check if the string is an operator
- *
- * @param string
- * @return unsigned char
+ * @brief Perfect hash of the keywords (length, first and last character)
  */
-static inline unsigned char strOperator(char *string)
-{
-    return (
-        //
-        !strcmp("==", string) ||
-        !strcmp("<=", string) ||
-        !strcmp(">=", string) ||
-        !strcmp("!=", string) ||
-        !strcmp("~=", string) || // Same as !=
-        !strcmp("&&", string) ||
-        !strcmp("||", string)
-        //
-    );
-}
+#define KEYWORD_HASH(first, last, length) (((length) * 2 + (first) + (last) * 19) & 31)
 
 /**
- * @brief Check if the string is a keyword
+ * @brief Keywords indexed by KEYWORD_HASH (no collision)
  *
- * @param string
- * @return unsigned char
+ * If you change a keyword in keywords.h, update its hash here.
  */
-static inline unsigned char strKeyword(char *string)
+static const struct
 {
-    return (
-        //
-        !strcmp(KEYWORD_DO, string) ||
-        !strcmp(KEYWORD_FN, string) ||
-        !strcmp(KEYWORD_IF, string) ||
-        !strcmp(KEYWORD_OR, string) ||
-        !strcmp(KEYWORD_LET, string) ||
-        !strcmp(KEYWORD_TRY, string) ||
-        !strcmp(KEYWORD_END, string) ||
-        !strcmp(KEYWORD_ELSE, string) ||
-        !strcmp(KEYWORD_WHILE, string) ||
-        !strcmp(KEYWORD_RAISE, string) ||
-        !strcmp(KEYWORD_BREAK, string) ||
-        !strcmp(KEYWORD_RETURN, string) ||
-        !strcmp(KEYWORD_IFERROR, string) ||
-        !strcmp(KEYWORD_LOADIMPORT, string) ||
-        // Custom keyword
-        soare_iskeyword(string)
-        //
-    );
-}
+
+    char *name;
+    keyword_id id;
+
+} KEYWORDS[32] = {
+
+    [KEYWORD_HASH('b', 'k', 5)] = {KEYWORD_BREAK, KW_BREAK},
+    [KEYWORD_HASH('d', 'o', 2)] = {KEYWORD_DO, KW_DO},
+    [KEYWORD_HASH('e', 'e', 4)] = {KEYWORD_ELSE, KW_ELSE},
+    [KEYWORD_HASH('e', 'd', 3)] = {KEYWORD_END, KW_END},
+    [KEYWORD_HASH('f', 'n', 2)] = {KEYWORD_FN, KW_FN},
+    [KEYWORD_HASH('i', 'f', 2)] = {KEYWORD_IF, KW_IF},
+    [KEYWORD_HASH('i', 'r', 7)] = {KEYWORD_IFERROR, KW_IFERROR},
+    [KEYWORD_HASH('l', 't', 3)] = {KEYWORD_LET, KW_LET},
+    [KEYWORD_HASH('l', 't', 10)] = {KEYWORD_LOADIMPORT, KW_LOADIMPORT},
+    [KEYWORD_HASH('o', 'r', 2)] = {KEYWORD_OR, KW_OR},
+    [KEYWORD_HASH('r', 'e', 5)] = {KEYWORD_RAISE, KW_RAISE},
+    [KEYWORD_HASH('r', 'n', 6)] = {KEYWORD_RETURN, KW_RETURN},
+    [KEYWORD_HASH('t', 'y', 3)] = {KEYWORD_TRY, KW_TRY},
+    [KEYWORD_HASH('w', 'e', 5)] = {KEYWORD_WHILE, KW_WHILE},
+
+};
 
 /**
- * @brief Give the type of the string
+ * @brief Give the keyword of a name
  *
  * @param string
- * @return token_type
+ * @param length
+ * @return keyword_id
  */
-static inline token_type Symbol(char *string)
+static inline keyword_id strKeyword(char *string, size_t length)
 {
-    return strKeyword(string) ? TKN_KEYWORD : TKN_NAME;
+    unsigned int hash = KEYWORD_HASH((unsigned char)string[0], (unsigned char)string[length - 1], length);
+
+    // One candidate: the name is a keyword if it is this one
+    if (KEYWORDS[hash].name && !strcmp(KEYWORDS[hash].name, string))
+        return KEYWORDS[hash].id;
+
+    // Custom keyword
+    return soare_iskeyword(string) ? KW_CUSTOM : KW_NONE;
 }
 
 /**
@@ -151,51 +210,57 @@ static void TranslateEscapeSequence(char *string)
     if (!string)
         return;
 
-    char *chr = string;
-    char *end = string + strlen(string);
+    // Characters are read ahead of where they are written
+    char *read = string;
+    char *write = string;
 
-    volatile int len = 1;
-
-    while (NULL != (chr = strchr(chr, '\\')))
+    while (*read)
     {
-        len = 1;
+        if (*read != '\\')
+        {
+            *write++ = *read++;
+            continue;
+        }
+
+        // Characters after the backslash
+        int len = 1;
 
-        switch (*(chr + 1))
+        switch (*(read + 1))
         {
         case 'e':
-            *chr = '\033';
+            *write = '\033';
             break;
 
         case 'n':
-            *chr = '\n';
+            *write = '\n';
             break;
 
         case 'f':
-            *chr = '\f';
+            *write = '\f';
             break;
 
         case 'r':
-            *chr = '\r';
+            *write = '\r';
             break;
 
         case 'a':
-            *chr = '\a';
+            *write = '\a';
             break;
 
         case 'v':
-            *chr = '\v';
+            *write = '\v';
             break;
 
         case 't':
-            *chr = '\t';
+            *write = '\t';
             break;
 
         case 'b':
-            *chr = '\b';
+            *write = '\b';
             break;
 
         case 'x':
-            *chr = (char)htoi(chr + 2);
+            *write = (char)htoi(read + 2);
             len = 3;
             break;
 
@@ -207,7 +272,7 @@ static void TranslateEscapeSequence(char *string)
         case '5':
         case '6':
         case '7':
-            *chr = (char)atoi(chr + 2);
+            *write = (char)atoi(read + 2);
             len = 3;
             break;
 
@@ -215,17 +280,23 @@ static void TranslateEscapeSequence(char *string)
         case '"':
         case '\'':
         case '\\':
-            *chr = *(chr + 1);
+            *write = *(read + 1);
             break;
 
         default:
-            LeaveException(InvalidEscapeSequence, chr, EmptyDocument());
+            LeaveException(InvalidEscapeSequence, read, EmptyDocument());
+            memmove(write, read, strlen(read) + 1);
             return;
         }
 
-        chr++;
-        memmove(chr, chr + len, end - chr + len);
+        write++;
+        read++;
+
+        for (; len && *read; len--)
+            read++;
     }
+
+    *write = 0;
 }
 
 /**
@@ -254,13 +325,14 @@ Document EmptyDocument(void)
  */
 Tokens *Token(char *__restrict__ filename, char *__restrict__ value, token_type type)
 {
-    Tokens *token = (Tokens *)malloc(sizeof(Tokens));
+    Tokens *token = (Tokens *)ArenaMalloc(sizeof(Tokens));
 
     if (!token)
         return __SOARE_OUT_OF_MEMORY();
 
-    token->value = !value ? NULL : strdup(value);
+    token->value = !value ? NULL : ArenaStrdup(value);
     token->type = type;
+    token->keyword = KW_NONE;
 
     token->file.ln = 0;
     token->file.col = 0;
@@ -303,12 +375,21 @@ unsigned char TokensFollowPattern(Tokens *tokens, unsigned int iteration, ...)
  */
 void TokensFree(Tokens *token)
 {
-    if (!token)
+    // Tokens built in an arena are released with it
+    if (!token || ARENA)
         return;
 
-    TokensFree(token->next);
-    free(token->value);
-    free(token);
+    while (token)
+    {
+        Tokens *next = token->next;
+
+        // Names are atoms
+        if (token->type != TKN_NAME && token->type != TKN_KEYWORD)
+            free(token->value);
+        free(token);
+
+        token = next;
+    }
 }
 
 #ifdef __SOARE_DEBUG
@@ -337,7 +418,7 @@ void TokensLog(Tokens *token)
     soare_write(
         //
         __soare_stdout,
-        "[TOKENS] [%s:%.5lld:%.5lld, %.2X, \"%s\"]\n",
+        "[TOKENS] [%s:%.5u:%.5u, %.2X, \"%s\"]\n",
         token->file.file,
         token->file.ln,
         token->file.col,
@@ -359,16 +440,13 @@ void TokensLog(Tokens *token)
  */
 static char *strcut(const char *string, size_t size)
 {
-    if (strlen(string) < size)
-        size = strlen(string);
-
-    char *result = (char *)malloc(size + 1);
+    // The tokenizer never cuts past the end of the text: no strlen
+    char *result = (char *)ArenaMalloc(size + 1);
 
     if (!result)
         return __SOARE_OUT_OF_MEMORY();
 
-    for (size_t ptr = 0; ptr < size; ptr++)
-        result[ptr] = string[ptr];
+    memmove(result, string, size);
 
     result[size] = 0;
     return result;
@@ -380,7 +458,7 @@ static char *strcut(const char *string, size_t size)
  * @param ln
  * @param col
  */
-static inline void updateln(unsigned long long *__restrict__ ln, unsigned long long *__restrict__ col)
+static inline void updateln(unsigned int *__restrict__ ln, unsigned int *__restrict__ col)
 {
     *ln = (*ln) + 1;
     *col = 1;
@@ -402,8 +480,8 @@ Tokens *Tokenizer(char *__restrict__ filename, char *__restrict__ text)
     Tokens *curr = token;
 
     // Line/Column
-    unsigned long long ln = 1;
-    unsigned long long col = 1;
+    unsigned int ln = 1;
+    unsigned int col = 1;
 
     while (*text)
     {
@@ -437,50 +515,21 @@ Tokens *Tokenizer(char *__restrict__ filename, char *__restrict__ text)
         }
 
         token_type type = TKN_EOF;
-        unsigned long long offset = 1;
+        unsigned int offset = 1;
 
         curr->file.ln = ln;
         curr->file.col = col;
 
-        // Let text = "<="
-        char operator[3] = {
-            //
-            0 [text], // <
-            1 [text], // =
-            0         // Null character
-            //
-        };
-
-        // Check if the string (operator) is an operator
-        if (strOperator(operator))
+        // Operators ==, <=, >=, !=, ~=, &&, ||
+        if (strOperator(text))
         {
             offset += 1;
             type = TKN_OPERATOR;
         }
 
-        // Assign
-        else if (*text == '=')
-            type = TKN_ASSIGN;
-
-        // Parenthesis
-        else if (*text == '(')
-            type = TKN_PARENL;
-        else if (*text == ')')
-            type = TKN_PARENR;
-
-        // Array
-        else if (*text == '[')
-            type = TKN_ARRAYL;
-        else if (*text == ']')
-            type = TKN_ARRAYR;
-
-        // Semicolon
-        else if (*text == ';')
-            type = TKN_SEMICOLON;
-
-        // Operator
-        else if (chrOperator(*text))
-            type = TKN_OPERATOR;
+        // Assign, parenthesis, array, semicolon and operators of 1 character
+        else if (PUNCTUATION[(unsigned char)*text])
+            type = PUNCTUATION[(unsigned char)*text];
 
         // Name
         else if (chrAlpha_(*text))
@@ -497,7 +546,7 @@ Tokens *Tokenizer(char *__restrict__ filename, char *__restrict__ text)
         }
 
         // String `str`|'str'|"str"
-        else if (strchr("\"'`", *text) != NULL)
+        else if (CHARACTERS[(unsigned char)*text] & CHR_QUOTE)
         {
             char ignore = 0;
             char quote = *text;
@@ -521,12 +570,15 @@ Tokens *Tokenizer(char *__restrict__ filename, char *__restrict__ text)
             continue;
         }
 
-        // Add token
-        curr->value = strcut(text, offset);
+        // Add token (names are atoms)
+        curr->value = !type ? AtomLength(text, offset) : strcut(text, offset);
         if (type == TKN_STRING)
             TranslateEscapeSequence(curr->value);
 
-        curr->type = !type ? Symbol(curr->value) : type;
+        if (!type)
+            curr->keyword = strKeyword(curr->value, offset);
+
+        curr->type = curr->keyword ? TKN_KEYWORD : !type ? TKN_NAME : type;
         curr->next = Token(filename, NULL, TKN_EOF);
 
         curr = curr->next;
@@ -534,7 +586,7 @@ Tokens *Tokenizer(char *__restrict__ filename, char *__restrict__ text)
         offset += type == TKN_STRING;
 
         // Update text pointer
-        for (unsigned long long i = 0; i < offset; i++)
+        for (unsigned int i = 0; i < offset; i++)
         {
             col++;
             if (*text == '\n')
@@ -0,0 +1,263 @@
+#include <STD/stdlib.h>
+#include <STD/stdarg.h>
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <Value.c>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+#include <SOARE/SOARE.h>
+
+/**
+ * @brief Return an empty value
+ *
+ * @return Value
+ */
+Value ValueNull(void)
+{
+    Value value;
+
+    value.type = VALUE_NULL;
+    value.string = NULL;
+
+    return value;
+}
+
+/**
+ * @brief Create an integer value
+ *
+ * @param number
+ * @return Value
+ */
+Value ValueNumber(int number)
+{
+    Value value;
+
+    value.type = VALUE_NUMBER;
+    value.number = number;
+
+    return value;
+}
+
+/**
+ * @brief Create a boolean value
+ *
+ * @param boolean
+ * @return Value
+ */
+Value ValueBoolean(char boolean)
+{
+    Value value;
+
+    value.type = VALUE_BOOLEAN;
+    value.number = boolean && 1;
+
+    return value;
+}
+
+/**
+ * @brief Create a value owning a string (VALUE_NULL if string is NULL)
+ *
+ * @param string
+ * @return Value
+ */
+Value ValueString(char *string)
+{
+    Value value;
+
+    value.type = string ? VALUE_STRING : VALUE_NULL;
+    value.string = string;
+
+    return value;
+}
+
+/**
+ * @brief Create a value borrowing a string (VALUE_NULL if string is NULL)
+ *
+ * @param string
+ * @return Value
+ */
+Value ValueReference(char *string)
+{
+    Value value;
+
+    value.type = string ? VALUE_REFERENCE : VALUE_NULL;
+    value.string = string;
+
+    return value;
+}
+
+/**
+ * @brief Create a new error, and return an empty value
+ *
+ * @param error
+ * @param string
+ * @param file
+ * @return Value
+ */
+Value ValueException(SoareExceptions error, char *string, Document file)
+{
+    LeaveException(error, string, file);
+    return ValueNull();
+}
+
+/**
+ * @brief Integer form of a value
+ *
+ * @param value
+ * @return int
+ */
+int ValueInt(Value value)
+{
+    switch (value.type)
+    {
+    case VALUE_NUMBER:
+    case VALUE_BOOLEAN:
+        return value.number;
+
+    case VALUE_STRING:
+    case VALUE_REFERENCE:
+        return atoi(value.string);
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief String form of a value, without allocation
+ *
+ * @param value
+ * @param buffer VALUE_BUFFER bytes, used by numbers
+ * @return char* (NULL for VALUE_NULL)
+ */
+char *ValueCString(Value value, char *buffer)
+{
+    switch (value.type)
+    {
+    case VALUE_NUMBER:
+        return itoa(buffer, VALUE_BUFFER, value.number);
+
+    case VALUE_BOOLEAN:
+        return value.number ? "1" : "0";
+
+    case VALUE_STRING:
+    case VALUE_REFERENCE:
+        return value.string;
+
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Check if a value is true (its string form is not "0")
+ *
+ * @param value
+ * @return unsigned char
+ */
+unsigned char ValueTruthy(Value value)
+{
+    switch (value.type)
+    {
+    case VALUE_NUMBER:
+    case VALUE_BOOLEAN:
+        return value.number != 0;
+
+    case VALUE_STRING:
+    case VALUE_REFERENCE:
+        return strcmp(value.string, "0") != 0;
+
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Check if 2 values have the same string form
+ *
+ * @param x
+ * @param y
+ * @return unsigned char
+ */
+unsigned char ValueEqual(Value x, Value y)
+{
+    // Immediates: decimal strings are equal if the integers are
+    if ((x.type == VALUE_NUMBER || x.type == VALUE_BOOLEAN) &&
+        (y.type == VALUE_NUMBER || y.type == VALUE_BOOLEAN))
+        return x.number == y.number;
+
+    char bx[VALUE_BUFFER], by[VALUE_BUFFER];
+
+    char *sx = ValueCString(x, bx);
+    char *sy = ValueCString(y, by);
+
+    if (!sx || !sy)
+        return sx == sy;
+
+    return !strcmp(sx, sy);
+}
+
+/**
+ * @brief Duplicate a value (strings are copied)
+ *
+ * @param value
+ * @return Value
+ */
+Value ValueCopy(Value value)
+{
+    if (value.type == VALUE_STRING || value.type == VALUE_REFERENCE)
+    {
+        char *string = strdup(value.string);
+        return string ? ValueString(string) : ValueException(InterpreterError, "OUT OF MEMORY", EmptyDocument());
+    }
+
+    return value;
+}
+
+/**
+ * @brief Make sure a value owns its string
+ *
+ * @param value
+ * @return Value
+ */
+Value ValueOwn(Value value)
+{
+    return value.type == VALUE_REFERENCE ? ValueCopy(value) : value;
+}
+
+/**
+ * @brief Convert a value to an allocated string, and free the value
+ *
+ * @param value
+ * @return char* (NULL for VALUE_NULL)
+ */
+char *ValueRelease(Value value)
+{
+    if (value.type == VALUE_STRING)
+        return value.string;
+
+    char buffer[VALUE_BUFFER];
+    char *string = ValueCString(value, buffer);
+
+    return string ? strdup(string) : NULL;
+}
+
+/**
+ * @brief Free a value
+ *
+ * @param value
+ */
+void ValueFree(Value value)
+{
+    if (value.type == VALUE_STRING)
+        free(value.string);
+}
@@ -44,20 +44,14 @@ void OUTB(unsigned short port, unsigned char value)
 }
 
 /**
- * @brief Busy-wait loop to simulate a sleep/delay for a given number of milliseconds.
+ * @brief Read the CPU time-stamp counter
  *
- *
- * @param ms
+ * @return unsigned long long
  */
-void SLEEP(unsigned int ms)
+unsigned long long RDTSC(void)
 {
-    volatile unsigned long count = 0;
-    // NOTE: Arbitrary value
-    unsigned long limit = ms * 500000;
-
-    while (count < limit)
-    {
-        __asm__ volatile("nop");
-        count++;
-    }
+    // Number of cycles since reset
+    unsigned int low, high;
+    __asm__ volatile("rdtsc" : "=a"(low), "=d"(high));
+    return ((unsigned long long)high << 32) | low;
 }
@@ -19,6 +19,16 @@
 // Stores the current keyboard layout.
 static KEYBOARD_LAYOUT KEYBOARD = QWERTY;
 
+// Scancodes received by KEYBOARD_IRQ and not read yet. The IRQ handler
+// only moves SCANCODES_HEAD and the readers only move SCANCODES_TAIL:
+// the 8-bit indexes wrap around the 256 entries, no lock is needed.
+static volatile unsigned char SCANCODES[256];
+static volatile unsigned char SCANCODES_HEAD = 0;
+static volatile unsigned char SCANCODES_TAIL = 0;
+
+// Keys held down (indexed by make code)
+static volatile unsigned char KEYS_DOWN[128];
+
 // Keyboard layout (Keymaps)
 static const char KEYBOARDS[][58] = {
     /* QWERTY */
@@ -113,6 +123,75 @@ static inline unsigned char is_shift_release(unsigned char keycode)
     return keycode == 0xAA || keycode == 0xB6;
 }
 
+/**
+ * @brief Drop the bytes waiting in the keyboard controller
+ *
+ */
+void KEYBOARD_FLUSH(void)
+{
+    // A full output buffer would never raise IRQ1 again
+    while (INB(KEYBOARD_STATUS) & KEYBOARD_OUTPUT_FULL)
+        INB(KEYBOARD_PORT);
+}
+
+/**
+ * @brief IRQ1 handler: store the scancode and the key state
+ *
+ */
+void KEYBOARD_IRQ(void)
+{
+    unsigned char scancode = INB(KEYBOARD_PORT);
+
+    // Prefix of the extended keys (arrows, ...): the next byte is the key
+    if (scancode != 0xE0)
+        KEYS_DOWN[scancode & 0x7F] = !(scancode & 0x80);
+
+    // Buffer full: the newest key is lost
+    if ((unsigned char)(SCANCODES_HEAD + 1) == SCANCODES_TAIL)
+        return;
+
+    SCANCODES[SCANCODES_HEAD] = scancode;
+    SCANCODES_HEAD++;
+}
+
+/**
+ * @brief Wait for the next scancode (the CPU sleeps until an interrupt)
+ *
+ * @return unsigned char
+ */
+unsigned char KEYBOARD_READ(void)
+{
+    while (1)
+    {
+        __asm__ volatile("cli");
+
+        if (SCANCODES_HEAD != SCANCODES_TAIL)
+            break;
+
+        // Interrupts are enabled after hlt starts: no IRQ is missed
+        __asm__ volatile("sti\n\t"
+                         "hlt");
+    }
+
+    __asm__ volatile("sti");
+
+    unsigned char scancode = SCANCODES[SCANCODES_TAIL];
+    SCANCODES_TAIL++;
+
+    return scancode;
+}
+
+/**
+ * @brief Check if a key is held down
+ *
+ * @param scancode Make code
+ * @return unsigned char
+ */
+unsigned char KEYBOARD_PRESSED(unsigned char scancode)
+{
+    return KEYS_DOWN[scancode & 0x7F];
+}
+
 /**
  * @brief Single Character Input
  *
@@ -127,7 +206,7 @@ char GETC(void)
     while (!character)
     {
         // Waits for a key press,
-        unsigned char keycode = INB(KEYBOARD_PORT);
+        unsigned char keycode = KEYBOARD_READ();
 
         // handles shift state,
         if (is_shift_key(keycode))
@@ -143,11 +222,8 @@ char GETC(void)
         }
 
         // and returns the corresponding ASCII character
+        // (releases are above the keymaps)
         character = ascii_char(keycode, shifted);
-
-        // Wait for key release
-        while (INB(KEYBOARD_PORT) == keycode)
-            /* pass */;
     }
 
     return character;
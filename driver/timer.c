@@ -0,0 +1,335 @@
+#include <DRIVER/timer.h>
+
+#include <STD/stddef.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <timer.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// Channel 0, low then high byte, mode 2 (rate generator)
+#define PIT_RATE_GENERATOR 0x34
+
+// Ticks measured by TIMER_CALIBRATE (~50 ms)
+#define TIMER_CALIBRATION 50
+
+// Scale of the TSC to ns factor (fits 32 bits: 1000000 << 12 < 2^32)
+#define TSC_SCALE_SHIFT 12
+
+/**
+ * @brief Callback waiting in the queue
+ */
+typedef struct timer_entry
+{
+
+    // Tick of the next call
+    unsigned long long deadline;
+    // Ticks between calls (0: once)
+    unsigned int period;
+
+    timer_callback_t callback;
+    void *data;
+
+    // Next entry (sorted by deadline)
+    struct timer_entry *next;
+
+} timer_entry_t;
+
+// Ticks since TIMER_INIT (written by TIMER_IRQ)
+static volatile unsigned long long TICKS = 0;
+// TSC at the last tick
+static volatile unsigned long long TICK_TSC = 0;
+
+// PIT programmed by TIMER_INIT
+static unsigned char RUNNING = 0;
+
+// TSC frequency (kHz) and ns per cycle << TSC_SCALE_SHIFT
+static unsigned int TSC_KHZ = 0;
+static unsigned int TSC_SCALE = 0;
+
+// Callback entries, and the queue (next deadline first)
+static timer_entry_t ENTRIES[TIMER_CALLBACKS];
+static timer_entry_t *QUEUE = NULL;
+
+/**
+ * @brief Disable interrupts
+ *
+ * @return unsigned int Previous EFLAGS (see irq_restore)
+ */
+static inline unsigned int irq_save(void)
+{
+    unsigned int flags;
+    __asm__ volatile("pushfl\n\t"
+                     "popl %0\n\t"
+                     "cli"
+                     : "=r"(flags)
+                     :
+                     : "memory");
+    return flags;
+}
+
+/**
+ * @brief Enable interrupts again if they were enabled
+ *
+ * @param flags
+ */
+static inline void irq_restore(unsigned int flags)
+{
+    __asm__ volatile("pushl %0\n\t"
+                     "popfl"
+                     :
+                     : "r"(flags)
+                     : "memory", "cc");
+}
+
+/**
+ * @brief Insert an entry in the queue (sorted by deadline)
+ *
+ * @param entry
+ */
+static void queue_insert(timer_entry_t *entry)
+{
+    timer_entry_t **link = &QUEUE;
+
+    // Same deadline: first come, first called
+    while (*link && (*link)->deadline <= entry->deadline)
+        link = &(*link)->next;
+
+    entry->next = *link;
+    *link = entry;
+}
+
+/**
+ * @brief Program the PIT at TIMER_HZ (install TIMER_IRQ on IRQ 0 next)
+ *
+ */
+void TIMER_INIT(void)
+{
+    OUTB(PIT_COMMAND, PIT_RATE_GENERATOR);
+    OUTB(PIT_CHANNEL0, TIMER_DIVISOR & 0xFF);
+    OUTB(PIT_CHANNEL0, TIMER_DIVISOR >> 8);
+
+    RUNNING = 1;
+}
+
+/**
+ * @brief IRQ0 handler: count the tick and run the callbacks due
+ *
+ */
+void TIMER_IRQ(void)
+{
+    TICK_TSC = RDTSC();
+    TICKS++;
+
+    while (QUEUE && QUEUE->deadline <= TICKS)
+    {
+        timer_entry_t *entry = QUEUE;
+        QUEUE = entry->next;
+
+        // Periodic: queued again before the call (it may cancel itself)
+        if (entry->period)
+        {
+            entry->deadline += entry->period;
+            queue_insert(entry);
+        }
+
+        timer_callback_t callback = entry->callback;
+
+        if (!entry->period)
+            entry->callback = NULL;
+
+        callback(entry->data);
+    }
+}
+
+/**
+ * @brief Ticks since TIMER_INIT
+ *
+ * @return unsigned long long
+ */
+unsigned long long TIMER_TICKS(void)
+{
+    // 64-bit reads are 2 loads: no tick between them
+    unsigned int flags = irq_save();
+    unsigned long long ticks = TICKS;
+    irq_restore(flags);
+
+    return ticks;
+}
+
+/**
+ * @brief Measure the TSC frequency against the PIT (interrupts enabled)
+ *
+ */
+void TIMER_CALIBRATE(void)
+{
+    if (!RUNNING)
+        return;
+
+    // TSC of 2 ticks, as read by TIMER_IRQ
+    unsigned long long start = TIMER_TICKS() + 1;
+
+    while (TIMER_TICKS() < start)
+        __asm__ volatile("hlt");
+
+    unsigned int flags = irq_save();
+    unsigned long long tsc = TICK_TSC;
+    unsigned long long first = TICKS;
+    irq_restore(flags);
+
+    while (TIMER_TICKS() < first + TIMER_CALIBRATION)
+        __asm__ volatile("hlt");
+
+    flags = irq_save();
+    unsigned long long cycles = TICK_TSC - tsc;
+    unsigned long long ticks = TICKS - first;
+    irq_restore(flags);
+
+    // 64-bit division is not available: 50 ms of cycles fit in 32 bits
+    // (up to 85 GHz), and a tick is 1 ms within 0.02%
+    if (cycles >> 32 || !ticks)
+        return;
+
+    TSC_KHZ = (unsigned int)cycles / (unsigned int)ticks;
+    TSC_SCALE = TSC_KHZ ? (1000000U << TSC_SCALE_SHIFT) / TSC_KHZ : 0;
+}
+
+/**
+ * @brief TSC frequency (kHz), 0 if not calibrated
+ *
+ * @return unsigned int
+ */
+unsigned int TIMER_TSC_KHZ(void)
+{
+    return TSC_KHZ;
+}
+
+/**
+ * @brief Monotonic time since TIMER_INIT (ns), refined with the TSC
+ *
+ * @return unsigned long long
+ */
+unsigned long long uptime_ns(void)
+{
+    unsigned int flags = irq_save();
+    unsigned long long ticks = TICKS;
+    unsigned long long tsc = TICK_TSC;
+    irq_restore(flags);
+
+    unsigned long long ns = ticks * TIMER_TICK_NS;
+
+    if (!TSC_SCALE)
+        return ns;
+
+    // Time since the last tick, never a whole tick (late interrupt)
+    unsigned long long elapsed = RDTSC() - tsc;
+    unsigned long long fraction = (elapsed * TSC_SCALE) >> TSC_SCALE_SHIFT;
+
+    return ns + (fraction < TIMER_TICK_NS ? fraction : TIMER_TICK_NS - 1);
+}
+
+/**
+ * @brief Call a function after a delay, then every period
+ *
+ * @param callback
+ * @param data Given to the callback
+ * @param delay Milliseconds before the first call
+ * @param period Milliseconds between the next calls (0: once)
+ * @return unsigned int Handle for TIMER_CANCEL (0 if the queue is full)
+ */
+unsigned int TIMER_CALLBACK(timer_callback_t callback, void *data, unsigned int delay, unsigned int period)
+{
+    if (!callback)
+        return 0;
+
+    unsigned int flags = irq_save();
+
+    for (unsigned int i = 0; i < TIMER_CALLBACKS; i++)
+    {
+        timer_entry_t *entry = &ENTRIES[i];
+
+        if (entry->callback)
+            continue;
+
+        // 1 tick per millisecond; at least one tick from now
+        entry->deadline = TICKS + (delay ? delay : 1);
+        entry->period = period;
+        entry->callback = callback;
+        entry->data = data;
+
+        queue_insert(entry);
+        irq_restore(flags);
+
+        return i + 1;
+    }
+
+    irq_restore(flags);
+    return 0;
+}
+
+/**
+ * @brief Remove a callback from the queue
+ *
+ * @param handle
+ */
+void TIMER_CANCEL(unsigned int handle)
+{
+    if (!handle || handle > TIMER_CALLBACKS)
+        return;
+
+    timer_entry_t *entry = &ENTRIES[handle - 1];
+    unsigned int flags = irq_save();
+
+    for (timer_entry_t **link = &QUEUE; *link; link = &(*link)->next)
+    {
+        if (*link != entry)
+            continue;
+
+        *link = entry->next;
+        break;
+    }
+
+    entry->callback = NULL;
+    irq_restore(flags);
+}
+
+/**
+ * @brief Wait for a given number of milliseconds (the CPU halts between ticks)
+ *
+ * @param ms (milliseconds)
+ */
+void SLEEP(unsigned int ms)
+{
+    if (!ms)
+        return;
+
+    // No tick yet: busy-wait (the delay depends on the CPU)
+    if (!TIMER_TICKS())
+    {
+        volatile unsigned long count = 0;
+        unsigned long limit = ms * 500000;
+
+        while (count < limit)
+        {
+            __asm__ volatile("nop");
+            count++;
+        }
+        return;
+    }
+
+    // The current tick is partly over: wait one more
+    unsigned long long end = TIMER_TICKS() + ms + 1;
+
+    // Each tick wakes the CPU
+    while (TIMER_TICKS() < end)
+        __asm__ volatile("hlt");
+}
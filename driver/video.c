@@ -25,6 +25,9 @@ static unsigned char GLOBAL_COLOR = 0x0F;
 // Indicates if the cursor should be updated after output
 static unsigned char MOVE_CURSOR = 0x1;
 
+// Position last written to the hardware cursor (0xFFFF: unknown)
+static unsigned short CURSOR_SHOWN = 0xFFFF;
+
 // Controls text blinking (attribute mask)
 static unsigned char BLINK = 0x7F;
 
@@ -47,6 +50,12 @@ static void update_cursor_location(void)
 
     unsigned short position = (unsigned short)(VGA_POINTER / 2);
 
+    // Port writes are slow (VM exits): skip them if nothing moved
+    if (position == CURSOR_SHOWN)
+        return;
+
+    CURSOR_SHOWN = position;
+
     OUTB(0x3D4, 0x0F);
     OUTB(0x3D5, (unsigned char)(position & 0xFF));
 
@@ -162,17 +171,15 @@ static void SCREEN_TEXT_SCROLL()
         VIDEO[i] = VIDEO[i + (SCREEN_TEXT_WIDTH * 2)];
         VIDEO[i + (SCREEN_TEXT_WIDTH * 2)] = i % 2 ? GLOBAL_COLOR & BLINK : 0;
     }
-
-    update_cursor_location();
 }
 
 /**
- * @brief Writes single character to stream output at current position (colored)
+ * @brief Writes single character at current position, without moving the cursor
  *
  * @param character
  * @param color
  */
-void CPUTC(const char character, const unsigned char color)
+static void console_write(const char character, const unsigned char color)
 {
     char *VIDEO = (char *)VGA_TEXT_ADDRESS;
 
@@ -202,7 +209,17 @@ void CPUTC(const char character, const unsigned char color)
         VIDEO[(volatile unsigned short)VGA_POINTER++] = color & BLINK;
         break;
     }
+}
 
+/**
+ * @brief Writes single character to stream output at current position (colored)
+ *
+ * @param character
+ * @param color
+ */
+void CPUTC(const char character, const unsigned char color)
+{
+    console_write(character, color);
     update_cursor_location();
 }
 
@@ -217,7 +234,10 @@ void CPUTS(const char *string, const unsigned char color)
     if (!string)
         return CPUTS("(null)", color);
     for (; *string; string++)
-        CPUTC(*string, color);
+        console_write(*string, color);
+
+    // The cursor moves once per string
+    update_cursor_location();
 }
 
 /**
@@ -35,10 +35,10 @@ unsigned char INB(unsigned short port);
 void OUTB(unsigned short port, unsigned char value);
 
 /**
- * @brief Busy-wait loop to simulate a sleep/delay for a given number of milliseconds.
+ * @brief Read the CPU time-stamp counter
  *
- * @param ms (milliseconds)
+ * @return unsigned long long
  */
-void SLEEP(unsigned int ms);
+unsigned long long RDTSC(void);
 
 #endif /* __IO_H__ */
\ No newline at end of file
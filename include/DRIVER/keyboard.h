@@ -21,6 +21,10 @@
  */
 
 #define KEYBOARD_PORT 0x60
+#define KEYBOARD_STATUS 0x64
+
+// Status bit: a byte is waiting in KEYBOARD_PORT
+#define KEYBOARD_OUTPUT_FULL 0x01
 
 /**
  * @brief Keyboard layout selector
@@ -40,6 +44,33 @@ typedef enum keyboard_layout
  */
 void KEYBOARD_INIT(KEYBOARD_LAYOUT _Keyboard);
 
+/**
+ * @brief Drop the bytes waiting in the keyboard controller
+ *
+ */
+void KEYBOARD_FLUSH(void);
+
+/**
+ * @brief IRQ1 handler: store the scancode and the key state
+ *
+ */
+void KEYBOARD_IRQ(void);
+
+/**
+ * @brief Wait for the next scancode (the CPU sleeps until an interrupt)
+ *
+ * @return unsigned char
+ */
+unsigned char KEYBOARD_READ(void);
+
+/**
+ * @brief Check if a key is held down
+ *
+ * @param scancode Make code
+ * @return unsigned char
+ */
+unsigned char KEYBOARD_PRESSED(unsigned char scancode);
+
 /**
  * @brief Single Character Input
  *
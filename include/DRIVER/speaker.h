@@ -4,6 +4,7 @@
 /* #pragma once */
 
 #include "io.h"
+#include "timer.h"
 
 /**
  *
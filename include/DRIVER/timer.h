@@ -0,0 +1,114 @@
+#ifndef __TIMER_H__
+#define __TIMER_H__ 0x1
+
+/* #pragma once */
+
+#include "io.h"
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <timer.h>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// PIT channel 0 data port and command port
+#define PIT_CHANNEL0 0x40
+#define PIT_COMMAND 0x43
+
+// PIT input clock (Hz)
+#define PIT_FREQUENCY 1193182
+
+// Timer interrupts per second (1 tick per millisecond)
+#define TIMER_HZ 1000
+
+// PIT divisor for TIMER_HZ
+#define TIMER_DIVISOR ((PIT_FREQUENCY + TIMER_HZ / 2) / TIMER_HZ)
+
+// Exact length of a tick (ns)
+#define TIMER_TICK_NS ((unsigned int)(TIMER_DIVISOR * 1000000000ULL / PIT_FREQUENCY))
+
+// Callbacks that can wait at the same time
+#define TIMER_CALLBACKS 16
+
+/**
+ * @brief Function called by the timer interrupt (must be short)
+ *
+ * It runs with interrupts disabled: it must not wait for a tick or a key
+ * (SLEEP, KEYBOARD_READ). The FPU/SSE state of the interrupted code is
+ * saved around it (see interrupt_dispatch), so it may use the stdlib.
+ */
+typedef void (*timer_callback_t)(void *data);
+
+/**
+ * @brief Program the PIT at TIMER_HZ (install TIMER_IRQ on IRQ 0 next)
+ *
+ */
+void TIMER_INIT(void);
+
+/**
+ * @brief IRQ0 handler: count the tick and run the callbacks due
+ *
+ */
+void TIMER_IRQ(void);
+
+/**
+ * @brief Measure the TSC frequency against the PIT (interrupts enabled)
+ *
+ */
+void TIMER_CALIBRATE(void);
+
+/**
+ * @brief Ticks since TIMER_INIT
+ *
+ * @return unsigned long long
+ */
+unsigned long long TIMER_TICKS(void);
+
+/**
+ * @brief TSC frequency (kHz), 0 if not calibrated
+ *
+ * @return unsigned int
+ */
+unsigned int TIMER_TSC_KHZ(void);
+
+/**
+ * @brief Monotonic time since TIMER_INIT (ns), refined with the TSC
+ *
+ * @return unsigned long long
+ */
+unsigned long long uptime_ns(void);
+
+/**
+ * @brief Call a function after a delay, then every period
+ *
+ * @param callback
+ * @param data Given to the callback
+ * @param delay Milliseconds before the first call
+ * @param period Milliseconds between the next calls (0: once)
+ * @return unsigned int Handle for TIMER_CANCEL (0 if the queue is full)
+ */
+unsigned int TIMER_CALLBACK(timer_callback_t callback, void *data, unsigned int delay, unsigned int period);
+
+/**
+ * @brief Remove a callback from the queue
+ *
+ * @param handle
+ */
+void TIMER_CANCEL(unsigned int handle);
+
+/**
+ * @brief Wait for a given number of milliseconds (the CPU halts between ticks)
+ *
+ * @param ms (milliseconds)
+ */
+void SLEEP(unsigned int ms);
+
+#endif /* __TIMER_H__ */
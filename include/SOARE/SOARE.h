@@ -63,9 +63,9 @@ namespace SOARE
             char *file;
 
             // Line
-            unsigned long long ln;
+            unsigned int ln;
             // Column
-            unsigned long long col;
+            unsigned int col;
 
         } Document;
 
@@ -73,13 +73,30 @@ namespace SOARE
 #include "utils/platform.h"
 
 #include "core/error.h"
+#include "core/arena.h"
+#include "core/atom.h"
+#include "core/value.h"
 #include "core/tokenizer.h"
 #include "core/parser.h"
 #include "core/memory.h"
 #include "core/math.h"
+#include "core/optimizer.h"
 #include "core/runtime.h"
+#include "core/bytecode.h"
+#include "core/cache.h"
 
-        typedef AST soare_arguments_list;
+        /**
+         * @brief Arguments of a call, evaluated once (see soare_getarg)
+         */
+        typedef struct soare_arguments
+        {
+
+            // Number of arguments
+            unsigned int argc;
+            // Evaluated arguments, followed by NULL
+            char **argv;
+
+        } *soare_arguments_list;
 
 #include "core/custom.h"
 
@@ -0,0 +1,81 @@
+#ifndef __SOARE_ARENA_H__
+#define __SOARE_ARENA_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <arena.h>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+/**
+ * @brief Block of memory owned by an arena
+ */
+typedef struct arena_chunk
+{
+
+    // Next chunk
+    struct arena_chunk *next;
+
+    // Capacity
+    size_t size;
+    // Bytes used
+    size_t used;
+
+} arena_chunk;
+
+/**
+ * @brief Bump-pointer allocator, released in one operation
+ */
+typedef struct arena
+{
+
+    // Current chunk (head of the list)
+    arena_chunk *chunk;
+
+} Arena;
+
+// Arena used by Token, Branch and the tokenizer (NULL: malloc)
+extern Arena *ARENA;
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * @param arena
+ * @param size
+ * @return void*
+ */
+void *ArenaAlloc(Arena *arena, size_t size);
+
+/**
+ * @brief Allocate from ARENA if set, malloc otherwise
+ *
+ * @param size
+ * @return void*
+ */
+void *ArenaMalloc(size_t size);
+
+/**
+ * @brief String duplicate in ARENA if set, strdup otherwise
+ *
+ * @param string
+ * @return char*
+ */
+char *ArenaStrdup(const char *string);
+
+/**
+ * @brief Release all the memory of an arena
+ *
+ * @param arena
+ */
+void ArenaFree(Arena *arena);
+
+#endif /* __SOARE_ARENA_H__ */
@@ -0,0 +1,52 @@
+#ifndef __SOARE_ATOM_H__
+#define __SOARE_ATOM_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <atom.h>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+/**
+ * Atoms are interned names: there is one copy of each name, so two
+ * atoms are equal if their addresses are. They are never freed.
+ */
+
+/* Hash of an atom (its address, atoms are 4-byte aligned) */
+#define ATOM_HASH(atom) ((unsigned int)(size_t)(atom) >> 2)
+
+/**
+ * @brief Give the atom of a name (created if needed)
+ *
+ * @param string
+ * @return char* (NULL if there is not enough memory)
+ */
+char *Atom(const char *string);
+
+/**
+ * @brief Give the atom of the first characters of a string (created if needed)
+ *
+ * @param string
+ * @param length
+ * @return char* (NULL if there is not enough memory)
+ */
+char *AtomLength(const char *string, size_t length);
+
+/**
+ * @brief Find the atom of a name, without creating it
+ *
+ * @param string
+ * @return char* (NULL if the name was never interned)
+ */
+char *AtomFind(const char *string);
+
+#endif /* __SOARE_ATOM_H__ */
@@ -0,0 +1,131 @@
+#ifndef __SOARE_BYTECODE_H__
+#define __SOARE_BYTECODE_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <bytecode.h>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+/**
+ * @brief List of instructions
+ *
+ * Operands follow the opcode in the code. `k` is an index in the constant
+ * pool, `target` is a position in the code.
+ */
+typedef enum opcode
+{
+
+    // Expressions
+
+    // push NULL
+    OP_NULL,
+    // k: push a literal
+    OP_PUSH,
+    // k: push a variable
+    OP_LOAD,
+    // k eval: push the result of a call (eval: NULL on error, as Eval does)
+    OP_CALL,
+    // math_operator k: pop y, pop x, push x op y
+    OP_OPERATE,
+    // target: jump if the top of the stack is NULL
+    OP_SKIP_NULL,
+    // k: pop index, pop value, push value[index]
+    OP_INDEX,
+    // k: push variable[index] (see MathSubscript)
+    OP_SUBSCRIPT,
+
+    // Statements (`end` is the end of the current block)
+
+    // end: pop and free a value
+    OP_POP,
+    // k end: pop a value into a new variable
+    OP_DEFINE,
+    // k end: check that a variable can be assigned
+    OP_RESOLVE,
+    // k end: pop a value into a variable
+    OP_ASSIGN,
+    // k end: append to a variable (name = name, x, see MathAppend)
+    OP_APPEND,
+    // k end: define a function
+    OP_FUNCTION,
+    // k end: run a custom keyword
+    OP_KEYWORD,
+    // k end: raise an exception
+    OP_RAISE,
+    // end: break out of the loop
+    OP_BREAK,
+    // end: pop a value, return it if it is not NULL
+    OP_RETURN,
+
+    // Blocks and jumps
+
+    // end: open a scope
+    OP_ENTER,
+    // close the innermost scope
+    OP_EXIT,
+    // next stop: pop a condition (NULL: stop, false: next)
+    OP_TEST,
+    // target: pop a condition, jump if the loop is over
+    OP_WHILE,
+    // target: jump if a break is pending
+    OP_BROKEN,
+    // target: jump if there is an error
+    OP_CHECK,
+    // target: jump
+    OP_JUMP,
+    // ignore the exceptions
+    OP_TRY,
+    // target: restore the exceptions, jump if there is nothing to catch
+    OP_CATCH,
+    // return NULL
+    OP_HALT
+
+} opcode;
+
+/**
+ * @brief Compiled block of code (function body or script)
+ */
+typedef struct chunk
+{
+
+    // Instructions and operands
+    int *code;
+    // Constant pool (nodes: value and document)
+    AST *constants;
+
+    // Value stack size
+    unsigned int stack;
+    // Deepest scope nesting
+    unsigned int scopes;
+    // Deepest try nesting
+    unsigned int tries;
+
+} Chunk;
+
+/**
+ * @brief Compile a tree, and the bodies of its functions (allocated in ARENA)
+ *
+ * @param tree
+ * @return Chunk*
+ */
+Chunk *Compile(AST tree);
+
+/**
+ * @brief Execute a chunk
+ *
+ * @param chunk
+ * @return Value
+ */
+Value Machine(Chunk *chunk);
+
+#endif /* __SOARE_BYTECODE_H__ */
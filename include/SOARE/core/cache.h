@@ -0,0 +1,100 @@
+#ifndef __SOARE_CACHE_H__
+#define __SOARE_CACHE_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <cache.h>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+/* Number of programs kept by the cache */
+#define CACHE_ENTRIES 16
+
+/**
+ * @brief Parsed program, owned by the cache or by one Execute
+ */
+typedef struct program
+{
+
+    // Hash of the code
+    unsigned int hash;
+    // File name (in arena)
+    char *file;
+    // Source code (in arena)
+    char *code;
+
+    // Tree
+    AST ast;
+    // Bytecode (compiled on first use by the bytecode engine)
+    Chunk *chunk;
+
+    // Memory of the tree, the bytecode and the strings above
+    Arena arena;
+
+    // Executes running this program
+    unsigned int pins;
+    // Last use (LRU)
+    unsigned int used;
+    // Owned by the cache
+    unsigned char cached;
+
+} Program;
+
+/**
+ * @brief Cache statistics
+ */
+typedef struct soare_cache_stats
+{
+
+    // Programs found in the cache
+    unsigned int hits;
+    // Programs parsed
+    unsigned int misses;
+    // Programs dropped to make room
+    unsigned int evictions;
+    // Programs in the cache
+    unsigned int entries;
+
+} soare_cache_stats;
+
+/**
+ * @brief Find a parsed program, and pin it
+ *
+ * @param file
+ * @param code
+ * @return Program* (NULL if the code was never parsed)
+ */
+Program *CacheGet(char *file, char *code);
+
+/**
+ * @brief Move a parsed program into the cache (evicts the least recently used), and pin it
+ *
+ * @param program
+ * @return Program* (program itself if every entry is running)
+ */
+Program *CacheStore(Program *program);
+
+/**
+ * @brief Unpin a program (a program outside the cache is released)
+ *
+ * @param program
+ */
+void CacheRelease(Program *program);
+
+/**
+ * @brief Cache statistics
+ *
+ * @return soare_cache_stats
+ */
+soare_cache_stats soare_getcachestats(void);
+
+#endif /* __SOARE_CACHE_H__ */
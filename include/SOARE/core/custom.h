@@ -29,7 +29,10 @@ typedef struct soare_functions
 {
 
     char *name;
+    // Reads its arguments with soare_getarg (soare_addfunction)
     char *(*exec)(soare_arguments_list);
+    // Receives its evaluated arguments (soare_addnative)
+    char *(*native)(unsigned int, char **);
 
 } soare_function;
 
@@ -42,6 +45,18 @@ typedef struct soare_functions
  */
 unsigned int soare_addfunction(char *name, char *(*function)(soare_arguments_list));
 
+/**
+ * @brief Add defined function, called with its arguments already evaluated
+ *
+ * argv holds argc strings (NULL for an argument without value) followed by
+ * NULL; they are freed after the call.
+ *
+ * @param name
+ * @param native
+ * @return unsigned int
+ */
+unsigned int soare_addnative(char *name, char *(*native)(unsigned int argc, char **argv));
+
 /**
  * @brief Get defined function
  *
@@ -53,6 +68,8 @@ soare_function soare_getfunction(char *name);
 /**
  * @brief Get argument from a function call
  *
+ * The string belongs to the call and is freed after it returns.
+ *
  * @param args
  * @param position
  * @return char*
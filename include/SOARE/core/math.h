@@ -16,6 +16,31 @@
  *
  */
 
+/**
+ * @brief List of operators
+ */
+typedef enum math_operator
+{
+
+    MATH_CONCAT,
+    MATH_EQUAL,
+    MATH_NOT_EQUAL,
+    MATH_LESS,
+    MATH_LESS_EQUAL,
+    MATH_GREATER,
+    MATH_GREATER_EQUAL,
+    MATH_AND,
+    MATH_OR,
+    MATH_XOR,
+    MATH_MODULO,
+    MATH_MULTIPLY,
+    MATH_DIVIDE,
+    MATH_ADD,
+    MATH_SUBTRACT,
+    MATH_UNKNOWN
+
+} math_operator;
+
 /**
  * @brief Return the value as a node
  *
@@ -33,12 +58,65 @@ AST ParseValue(Tokens **tokens);
  */
 AST ParseExpr(Tokens **tokens, unsigned char priority);
 
+/**
+ * @brief Resolve the operator of a NODE_OPERATOR
+ *
+ * @param symbol
+ * @return math_operator
+ */
+math_operator MathOperator(char *symbol);
+
+/**
+ * @brief Apply an operator to 2 values (frees x and y)
+ *
+ * @param operator
+ * @param x
+ * @param y
+ * @param tree NODE_OPERATOR (errors)
+ * @return Value
+ */
+Value MathApply(math_operator operator, Value x, Value y, AST tree);
+
+/**
+ * @brief Read a variable with a subscript (name[index]) without copying it
+ *
+ * @param tree NODE_MEMGET with a NODE_ARRAY child
+ * @return Value
+ */
+Value MathSubscript(AST tree);
+
+/**
+ * @brief Check if an assignment only appends to its variable (name = name, x, ...)
+ *
+ * @param memset NODE_MEMSET
+ * @return unsigned char
+ */
+unsigned char MathIsAppend(AST memset);
+
+/**
+ * @brief Assign name = name, x, ... by growing the string of the variable in place
+ *
+ * @param variable
+ * @param memset NODE_MEMSET (see MathIsAppend)
+ */
+void MathAppend(MEM variable, AST memset);
+
+/**
+ * @brief Index a value (frees value and index)
+ *
+ * @param value
+ * @param index
+ * @param array NODE_ARRAY (errors)
+ * @return Value (value itself if index is NULL, VALUE_NULL if out of range)
+ */
+Value MathIndex(Value value, Value index, AST array);
+
 /**
  * @brief Evaluates the mathematical expression of a tree
  *
  * @param tree
- * @return char*
+ * @return Value
  */
-char *Eval(AST tree);
+Value Eval(AST tree);
 
 #endif /* __SOARE_MATH_H__ */
\ No newline at end of file
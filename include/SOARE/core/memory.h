@@ -25,15 +25,32 @@ typedef struct mem
     // Name
     char *name;
     // Value
-    char *value;
+    Value value;
+    // Length of a string value grown by MathAppend (MEM_LENGTH_UNKNOWN otherwise)
+    size_t length;
     // Body
     AST body;
 
     // Next
     struct mem *next;
 
+    // Hash of the name (see ATOM_HASH)
+    unsigned int hash;
+    // Next entry of the same bucket (newest first)
+    struct mem *bucket;
+    // Part of the MEMORY chain (listed in the index)
+    unsigned char indexed;
+
+    // Slot of a frame (freed with the frame, see MemFrame)
+    unsigned char slot;
+    // Unused slots after the last variable of a frame
+    unsigned short spares;
+
 } mem, *MEM;
 
+/* The length of the value must be measured */
+#define MEM_LENGTH_UNKNOWN ((size_t)-1)
+
 // Memory used by the interpreter
 extern MEM MEMORY;
 
@@ -44,6 +61,21 @@ extern MEM MEMORY;
  */
 MEM Mem(void);
 
+/**
+ * @brief Create an empty memory followed by slots for the next variables pushed (one allocation)
+ *
+ * @param slots
+ * @return MEM
+ */
+MEM MemFrame(unsigned int slots);
+
+/**
+ * @brief Create the memory used by the interpreter, whose variables are indexed
+ *
+ * @return MEM
+ */
+MEM MemRoot(void);
+
 /**
  * @brief Give the last variable in the memory
  *
@@ -56,10 +88,10 @@ MEM MemLast(MEM memory);
  * @brief Add a variable to an existing memory (free value if memory is NULL or if MemPush fail)
  *
  * @param memory
- * @param name
+ * @param name atom (see Atom)
  * @return MEM
  */
-MEM MemPush(mem *memory, char *name, char *value);
+MEM MemPush(mem *memory, char *name, Value value);
 
 /**
  * @brief Add a function to an existing memory
@@ -71,15 +103,39 @@ MEM MemPush(mem *memory, char *name, char *value);
  */
 MEM MemPushf(MEM memory, char *name, AST body);
 
+/**
+ * @brief Link a memory after another one (indexes it if it joins MEMORY)
+ *
+ * @param memory
+ * @param chain
+ */
+void MemAttach(MEM memory, MEM chain);
+
+/**
+ * @brief Free every variable after a memory
+ *
+ * @param memory
+ */
+void MemTruncate(MEM memory);
+
 /**
  * @brief Find a variable in the memory
  *
  * @param memory
- * @param name
+ * @param name atom (see Atom)
  * @return MEM
  */
 MEM MemGet(MEM memory, char *name);
 
+/**
+ * @brief Find a variable in the memory, reusing what the node found last time if its bucket has not changed
+ *
+ * @param memory
+ * @param node
+ * @return MEM
+ */
+MEM MemGetCached(MEM memory, AST node);
+
 /**
  * @brief Update a variable (free value if memory is NULL)
  *
@@ -87,7 +143,7 @@ MEM MemGet(MEM memory, char *name);
  * @param name
  * @return MEM
  */
-MEM MemSet(MEM memory, char *value);
+MEM MemSet(MEM memory, Value value);
 
 #ifdef __SOARE_DEBUG
 
@@ -0,0 +1,30 @@
+#ifndef __SOARE_OPTIMIZER_H__
+#define __SOARE_OPTIMIZER_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <optimizer.h>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+/**
+ * @brief Simplify a tree before it runs
+ *
+ * Folds constant expressions, turns constant true conditions (else)
+ * into NODE_ELSE and removes the branches of constant false conditions.
+ * New strings are allocated in the current arena.
+ *
+ * @param tree
+ */
+void Optimize(AST tree);
+
+#endif /* __SOARE_OPTIMIZER_H__ */
@@ -38,6 +38,7 @@ typedef enum node_type
     NODE_IFERROR,
     NODE_OPERATOR,
     NODE_CONDITION,
+    NODE_ELSE,
     NODE_REPETITION,
     NODE_BREAK,
     NODE_RETURN,
@@ -45,6 +46,21 @@ typedef enum node_type
 
 } node_type;
 
+/**
+ * @brief Variable resolved by a node (see MemGetCached)
+ */
+typedef struct node_cache
+{
+
+    // Variable found (NULL: not defined)
+    struct mem *mem;
+    // Version of the bucket of the name when it was resolved (0: empty)
+    unsigned int version;
+
+} node_cache;
+
+struct soare_arguments;
+
 /**
  * @brief Structure of a node
  */
@@ -65,13 +81,31 @@ typedef struct node
     struct node *child;
     // Node Sibling
     struct node *sibling;
+    // Depends on the type of the node
+    union
+    {
+        // Last child, while parsing (see BranchJoin, dropped by TreeFlatten)
+        struct node *last;
+
+        // NODE_BODY: bytecode of a function body (see bytecode.h)
+        struct chunk *code;
+
+        struct
+        {
+            // NODE_CALL: callee, NODE_MEMGET: function passed as an argument
+            node_cache cache;
+            // NODE_CALL: predefined function, resolved by its first run (see custom.h)
+            char *(*exec)(struct soare_arguments *);
+            char *(*native)(unsigned int, char **);
+        };
+    };
 
 } Node, *AST;
 
 /**
  * @brief Create a new node
  *
- * @param value
+ * @param value atom if the node names a variable, a function or a keyword
  * @param type
  * @param file
  * @return Node*
@@ -103,6 +137,17 @@ AST BranchJoin(Node *parent, Node *child);
  */
 void TreeFree(AST tree);
 
+/**
+ * @brief Copy a tree into one block of the current arena
+ *
+ * Nodes are stored depth-first (a node, its children, then its siblings)
+ * and equal values are shared.
+ *
+ * @param tree
+ * @return AST (NULL if there is not enough memory)
+ */
+AST TreeFlatten(AST tree);
+
 #ifdef __SOARE_DEBUG
 
 /**
@@ -16,6 +16,19 @@
  *
  */
 
+/**
+ * @brief List of engines
+ */
+typedef enum soare_engine
+{
+
+    // Walk the AST
+    ENGINE_TREE,
+    // Compile the AST, run the bytecode
+    ENGINE_BYTECODE
+
+} soare_engine;
+
 /**
  * @brief Initialize SOARE interpreter
  *
@@ -28,13 +41,56 @@ void soare_init(void);
  */
 void soare_kill(void);
 
+/**
+ * @brief Open a statement: a scope at the end of MEMORY, holding the pending function arguments
+ *
+ * @return MEM
+ */
+MEM StatementEnter(void);
+
+/**
+ * @brief Close a statement (frees its scope)
+ *
+ * @param statement
+ * @param returns
+ * @return Value
+ */
+Value StatementExit(MEM statement, Value returns);
+
+/**
+ * @brief Break out of the current loop
+ *
+ */
+void StatementBreak(void);
+
+/**
+ * @brief Check if a break is pending
+ *
+ * @return unsigned char
+ */
+unsigned char StatementBroken(void);
+
 /**
  * @brief Execute a function
  *
  * @param tree
- * @return char*
+ * @return Value
+ */
+Value RunFunction(AST tree);
+
+/**
+ * @brief Select the engine used by Execute
+ *
+ * @param engine
+ */
+void soare_setengine(soare_engine engine);
+
+/**
+ * @brief Engine used by Execute
+ *
+ * @return soare_engine
  */
-char *RunFunction(AST tree);
+soare_engine soare_getengine(void);
 
 /**
  * @brief Execute SOARE code
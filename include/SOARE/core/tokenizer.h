@@ -38,6 +38,32 @@ typedef enum token_type
 
 } token_type;
 
+/**
+ * @brief Keyword of a TKN_KEYWORD token (resolved by the tokenizer)
+ */
+typedef enum keyword_id
+{
+
+    KW_NONE,
+    KW_BREAK,
+    KW_DO,
+    KW_ELSE,
+    KW_END,
+    KW_FN,
+    KW_IF,
+    KW_IFERROR,
+    KW_LET,
+    KW_LOADIMPORT,
+    KW_OR,
+    KW_RAISE,
+    KW_RETURN,
+    KW_TRY,
+    KW_WHILE,
+    // Added with soare_addkeyword
+    KW_CUSTOM
+
+} keyword_id;
+
 /**
  * @brief Structure of a token
  */
@@ -48,6 +74,8 @@ typedef struct Tokens
     char *value;
     // Type
     token_type type;
+    // Keyword (KW_NONE if the token is not a keyword)
+    keyword_id keyword;
 
     // Document
     Document file;
@@ -0,0 +1,177 @@
+#ifndef __SOARE_VALUE_H__
+#define __SOARE_VALUE_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *  _____  _____  ___  ______ _____
+ * /  ___||  _  |/ _ \ | ___ \  ___|
+ * \ `--. | | | / /_\ \| |_/ / |__
+ *  `--. \| | | |  _  ||    /|  __|
+ * /\__/ /\ \_/ / | | || |\ \| |___
+ * \____/  \___/\_| |_/\_| \_\____/
+ *
+ * Antoine LANDRIEUX (MIT License) <value.h>
+ * <https://github.com/AntoineLandrieux/SOARE/>
+ *
+ */
+
+/* Size of a buffer holding any value of type VALUE_NUMBER as a string */
+#define VALUE_BUFFER 12
+
+/**
+ * @brief List the different types of values
+ */
+typedef enum value_type
+{
+
+    // No value (error, nothing returned)
+    VALUE_NULL,
+    // Immediate integer
+    VALUE_NUMBER,
+    // Immediate boolean ("0" or "1")
+    VALUE_BOOLEAN,
+    // String owned by the value (malloc)
+    VALUE_STRING,
+    // String owned by someone else (AST)
+    VALUE_REFERENCE
+
+} value_type;
+
+/**
+ * @brief Structure of a value
+ */
+typedef struct Value
+{
+
+    // Type
+    value_type type;
+
+    union
+    {
+        // VALUE_NUMBER, VALUE_BOOLEAN
+        int number;
+        // VALUE_STRING, VALUE_REFERENCE
+        char *string;
+    };
+
+} Value;
+
+/* Check if a value is VALUE_NULL */
+#define ValueIsNull(value) ((value).type == VALUE_NULL)
+
+/**
+ * @brief Return an empty value
+ *
+ * @return Value
+ */
+Value ValueNull(void);
+
+/**
+ * @brief Create an integer value
+ *
+ * @param number
+ * @return Value
+ */
+Value ValueNumber(int number);
+
+/**
+ * @brief Create a boolean value
+ *
+ * @param boolean
+ * @return Value
+ */
+Value ValueBoolean(char boolean);
+
+/**
+ * @brief Create a value owning a string (VALUE_NULL if string is NULL)
+ *
+ * @param string
+ * @return Value
+ */
+Value ValueString(char *string);
+
+/**
+ * @brief Create a value borrowing a string (VALUE_NULL if string is NULL)
+ *
+ * @param string
+ * @return Value
+ */
+Value ValueReference(char *string);
+
+/**
+ * @brief Create a new error, and return an empty value
+ *
+ * @param error
+ * @param string
+ * @param file
+ * @return Value
+ */
+Value ValueException(SoareExceptions error, char *string, Document file);
+
+/**
+ * @brief Integer form of a value
+ *
+ * @param value
+ * @return int
+ */
+int ValueInt(Value value);
+
+/**
+ * @brief String form of a value, without allocation
+ *
+ * @param value
+ * @param buffer VALUE_BUFFER bytes, used by numbers
+ * @return char* (NULL for VALUE_NULL)
+ */
+char *ValueCString(Value value, char *buffer);
+
+/**
+ * @brief Check if a value is true (its string form is not "0")
+ *
+ * @param value
+ * @return unsigned char
+ */
+unsigned char ValueTruthy(Value value);
+
+/**
+ * @brief Check if 2 values have the same string form
+ *
+ * @param x
+ * @param y
+ * @return unsigned char
+ */
+unsigned char ValueEqual(Value x, Value y);
+
+/**
+ * @brief Duplicate a value (strings are copied)
+ *
+ * @param value
+ * @return Value
+ */
+Value ValueCopy(Value value);
+
+/**
+ * @brief Make sure a value owns its string
+ *
+ * @param value
+ * @return Value
+ */
+Value ValueOwn(Value value);
+
+/**
+ * @brief Convert a value to an allocated string, and free the value
+ *
+ * @param value
+ * @return char* (NULL for VALUE_NULL)
+ */
+char *ValueRelease(Value value);
+
+/**
+ * @brief Free a value
+ *
+ * @param value
+ */
+void ValueFree(Value value);
+
+#endif /* __SOARE_VALUE_H__ */
@@ -36,4 +36,9 @@ typedef unsigned int uint32_t;
 /* 64 bit unsigned (8 byte) */
 typedef unsigned long uint64_t;
 
+/* Pointer */
+
+/* Unsigned integer holding an address */
+typedef unsigned long uintptr_t;
+
 #endif /* __STDINT_H__ */
\ No newline at end of file
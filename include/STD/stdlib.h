@@ -9,6 +9,37 @@
 #define EXIT_SUCCESS 0
 #define EXIT_FAILURE 1
 
+/* SSE2 enabled: stdlib_init selects the SSE2 functions */
+#define STDLIB_SSE2 0x1
+
+/**
+ * @brief Allocator statistics
+ */
+typedef struct malloc_stats
+{
+
+    // Successful malloc calls
+    size_t allocations;
+    // Allocations served by a size class
+    size_t small;
+    // free calls
+    size_t frees;
+    // Slabs carved for the size classes
+    size_t slabs;
+    // Bytes currently allocated
+    size_t used;
+
+    // Bytes managed by the allocator
+    size_t heap;
+    // Free large blocks
+    size_t free_blocks;
+    // Bytes in free large blocks
+    size_t free_bytes;
+    // Largest free block
+    size_t largest;
+
+} malloc_stats_t;
+
 /* File */
 typedef struct __flatfs_file_entry__ FILE;
 
@@ -20,6 +51,15 @@ typedef struct __flatfs_file_entry__ FILE;
  */
 int system(char *command);
 
+/**
+ * @brief Give more memory to malloc (implemented by the kernel)
+ *
+ * @param size Minimum number of bytes
+ * @param granted Number of bytes given
+ * @return void* (NULL if the system is out of memory)
+ */
+void *morecore(size_t size, size_t *granted);
+
 /**
  * @brief Memory allocation
  *
@@ -35,6 +75,64 @@ void *malloc(size_t size);
  */
 void free(void *ptr);
 
+/**
+ * @brief Resize allocated memory (grows in place when possible)
+ *
+ * @param ptr
+ * @param size
+ * @return void* (NULL if out of memory: ptr is left untouched)
+ */
+void *realloc(void *ptr, size_t size);
+
+/**
+ * @brief Usable size of allocated memory (at least the size requested)
+ *
+ * @param ptr
+ * @return size_t
+ */
+size_t msize(void *ptr);
+
+/**
+ * @brief Allocator statistics
+ *
+ * @return malloc_stats_t
+ */
+malloc_stats_t mstats(void);
+
+/**
+ * @brief Select the string and memory functions
+ *
+ * @param features STDLIB_* flags usable on this processor
+ */
+void stdlib_init(unsigned int features);
+
+/**
+ * @brief Features used by the string and memory functions
+ *
+ * @return unsigned int STDLIB_* flags
+ */
+unsigned int stdlib_features(void);
+
+/**
+ * @brief Copy a block of memory (the blocks must not overlap)
+ *
+ * @param destination
+ * @param source
+ * @param size
+ * @return void*
+ */
+void *memcpy(void *destination, const void *source, size_t size);
+
+/**
+ * @brief Fill a block of memory with a byte
+ *
+ * @param destination
+ * @param value
+ * @param size
+ * @return void*
+ */
+void *memset(void *destination, int value, size_t size);
+
 /**
  * @brief Copy a block of memory from a location to another
  *
@@ -84,9 +182,9 @@ char *strstr(const char *haystack, const char *needle);
  * @brief String length
  *
  * @param string
- * @return long long
+ * @return size_t
  */
-long long strlen(const char *string);
+size_t strlen(const char *string);
 
 /**
  * @brief Hex to int
@@ -0,0 +1,111 @@
+#ifndef __CPU_H__
+#define __CPU_H__ 0x1
+
+/* #pragma once */
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <cpu.h>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// CR0: monitor coprocessor (wait/fwait checks CR0.TS)
+#define CR0_MP (1U << 1)
+// CR0: x87 emulation (every FPU instruction faults)
+#define CR0_EM (1U << 2)
+// CR0: task switched (next FPU/SSE instruction faults)
+#define CR0_TS (1U << 3)
+// CR0: native FPU error reporting
+#define CR0_NE (1U << 5)
+
+// CR4: fxsave/fxrstor save the SSE state, SSE instructions allowed
+#define CR4_OSFXSR (1U << 9)
+// CR4: unmasked SSE floating-point exceptions raise #XM
+#define CR4_OSXMMEXCPT (1U << 10)
+
+// MXCSR at reset: every SSE exception masked, round to nearest
+#define MXCSR_DEFAULT 0x1F80
+
+/**
+ * @brief Processor identification and features
+ */
+typedef struct cpu_features
+{
+
+    // CPUID instruction available
+    unsigned char cpuid;
+    // Vendor string (e.g. "GenuineIntel")
+    char vendor[13];
+    // Highest standard CPUID leaf
+    unsigned int leaves;
+
+    // Family, model and stepping (extended values included)
+    unsigned int family;
+    unsigned int model;
+    unsigned int stepping;
+
+    // CPUID leaf 1 (EDX)
+    unsigned char fpu;
+    unsigned char tsc;
+    unsigned char mmx;
+    unsigned char fxsr;
+    unsigned char sse;
+    unsigned char sse2;
+
+    // CPUID leaf 1 (ECX)
+    unsigned char sse3;
+    unsigned char ssse3;
+    unsigned char sse41;
+    unsigned char sse42;
+    unsigned char popcnt;
+    unsigned char avx;
+
+    // x87 instructions usable (set by CPU_INIT)
+    unsigned char x87_enabled;
+    // SSE instructions usable (set by CPU_INIT)
+    unsigned char sse_enabled;
+
+} cpu_features_t;
+
+/**
+ * @brief FPU/SSE state saved by fxsave (fnsave uses the first 108 bytes)
+ */
+typedef struct fpu_state
+{
+
+    unsigned char data[512];
+
+} __attribute__((aligned(16))) fpu_state_t;
+
+// Features of the processor (filled by CPU_INIT)
+extern cpu_features_t CPU;
+
+/**
+ * @brief Detect the processor features, enable the FPU and SSE
+ *
+ */
+void CPU_INIT(void);
+
+/**
+ * @brief Save the FPU/SSE state
+ *
+ * @param state
+ */
+void FPU_SAVE(fpu_state_t *state);
+
+/**
+ * @brief Restore a FPU/SSE state
+ *
+ * @param state
+ */
+void FPU_RESTORE(fpu_state_t *state);
+
+#endif /* __CPU_H__ */
@@ -0,0 +1,74 @@
+#ifndef __INTERRUPT_H__
+#define __INTERRUPT_H__ 0x1
+
+/* #pragma once */
+
+#include <STD/stdint.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <interrupt.h>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// Kernel code segment selector
+#define GDT_CODE 0x08
+// Kernel data segment selector
+#define GDT_DATA 0x10
+
+// First vector of the hardware interrupts (after the CPU exceptions)
+#define IRQ_BASE 0x20
+// Number of hardware interrupts (2 chained PICs)
+#define IRQ_COUNT 16
+
+// Programmable interval timer
+#define IRQ_TIMER 0
+// PS/2 keyboard
+#define IRQ_KEYBOARD 1
+
+/**
+ * @brief Registers saved when an interrupt occurs
+ */
+typedef struct interrupt_frame
+{
+
+    // Saved by pusha
+    uint32_t edi, esi, ebp, esp, ebx, edx, ecx, eax;
+
+    // Pushed by the stub (error code: 0 if the CPU gives none)
+    uint32_t vector, error;
+
+    // Pushed by the CPU
+    uint32_t eip, cs, eflags;
+
+} interrupt_frame_t;
+
+/**
+ * @brief Hardware interrupt handler (runs with interrupts disabled)
+ */
+typedef void (*irq_handler_t)(void);
+
+/**
+ * @brief Load the GDT and the IDT, remap the PIC and enable interrupts
+ *
+ * Every IRQ stays masked until a handler is installed.
+ */
+void INTERRUPT_INIT(void);
+
+/**
+ * @brief Install the handler of an IRQ and unmask it
+ *
+ * @param irq
+ * @param handler
+ */
+void IRQ_INSTALL(unsigned char irq, irq_handler_t handler);
+
+#endif /* __INTERRUPT_H__ */
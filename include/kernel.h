@@ -42,6 +42,18 @@ extern char USERNAME[20];
  */
 void EDITOR(void);
 
+/**
+ * @brief Run the kernel benchmarks
+ *
+ */
+void BENCHMARK(void);
+
+/**
+ * @brief Compare the tree walker and the bytecode engine
+ *
+ */
+void SELFCHECK(void);
+
 /**
  * @brief Setup the kernel
  *
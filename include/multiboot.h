@@ -0,0 +1,81 @@
+#ifndef __MULTIBOOT_H__
+#define __MULTIBOOT_H__ 0x1
+
+/* #pragma once */
+
+#include <STD/stdint.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <multiboot.h>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// Value of EAX when the kernel is loaded by a multiboot bootloader
+#define MULTIBOOT_BOOTLOADER_MAGIC 0x2BADB002
+
+// `mem_lower` and `mem_upper` are valid
+#define MULTIBOOT_INFO_MEMORY 0x00000001
+// `mmap_addr` and `mmap_length` are valid
+#define MULTIBOOT_INFO_MEM_MAP 0x00000040
+
+// Memory map entry: available RAM
+#define MULTIBOOT_MEMORY_AVAILABLE 1
+
+/**
+ * @brief Multiboot information structure (given by the bootloader in EBX)
+ *
+ */
+typedef struct __attribute__((packed)) multiboot_info
+{
+
+    // Valid fields (MULTIBOOT_INFO_*)
+    uint32_t flags;
+
+    // Memory below 1 MiB (KiB)
+    uint32_t mem_lower;
+    // Memory above 1 MiB (KiB)
+    uint32_t mem_upper;
+
+    uint32_t boot_device;
+    uint32_t cmdline;
+
+    uint32_t mods_count;
+    uint32_t mods_addr;
+
+    uint32_t syms[4];
+
+    // Memory map (size in bytes, address)
+    uint32_t mmap_length;
+    uint32_t mmap_addr;
+
+} multiboot_info_t;
+
+/**
+ * @brief Multiboot memory map entry
+ *
+ */
+typedef struct __attribute__((packed)) multiboot_mmap_entry
+{
+
+    // Size of the entry, not counting this field
+    uint32_t size;
+
+    // Base address
+    unsigned long long addr;
+    // Length in bytes
+    unsigned long long len;
+    // Region type (MULTIBOOT_MEMORY_*)
+    uint32_t type;
+
+} multiboot_mmap_entry_t;
+
+#endif /* __MULTIBOOT_H__ */
@@ -0,0 +1,68 @@
+#ifndef __PMM_H__
+#define __PMM_H__ 0x1
+
+/* #pragma once */
+
+#include <STD/stddef.h>
+
+#include "multiboot.h"
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <pmm.h>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// Size of a physical page frame
+#define PAGE_SIZE 0x1000
+
+// Highest frame number + 1 (4 GiB of 32-bit physical memory)
+#define PMM_MAX_FRAMES 0x100000
+
+/**
+ * @brief Build the page-frame allocator from the multiboot memory map
+ *
+ * @param magic
+ * @param info
+ */
+void PMM_INIT(unsigned int magic, multiboot_info_t *info);
+
+/**
+ * @brief Allocate contiguous physical page frames
+ *
+ * @param count
+ * @return void* (NULL if there is no such range)
+ */
+void *PAGE_ALLOC(size_t count);
+
+/**
+ * @brief Release page frames
+ *
+ * @param address
+ * @param count
+ */
+void PAGE_FREE(void *address, size_t count);
+
+/**
+ * @brief Number of usable page frames
+ *
+ * @return size_t
+ */
+size_t PMM_TOTAL_FRAMES(void);
+
+/**
+ * @brief Number of free page frames
+ *
+ * @return size_t
+ */
+size_t PMM_FREE_FRAMES(void);
+
+#endif /* __PMM_H__ */
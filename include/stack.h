@@ -0,0 +1,51 @@
+#ifndef __STACK_H__
+#define __STACK_H__ 0x1
+
+/* #pragma once */
+
+#include <STD/stddef.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <stack.h>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+// Top of the kernel stack (see boot/entry.asm)
+#define STACK_TOP 0x90000
+
+// Bytes below STACK_TOP watched by the high-water mark
+#define STACK_WATCHED 0x10000
+
+// Value written in the unused stack
+#define STACK_PAINT 0x5AC55AC5
+
+/**
+ * @brief Fill the unused part of the watched stack with STACK_PAINT
+ *
+ */
+void STACK_INIT(void);
+
+/**
+ * @brief Deepest stack use since STACK_INIT, in bytes
+ *
+ * @return size_t (STACK_WATCHED if the whole watched area was used)
+ */
+size_t STACK_PEAK(void);
+
+/**
+ * @brief Current stack use, in bytes
+ *
+ * @return size_t
+ */
+size_t STACK_DEPTH(void);
+
+#endif /* __STACK_H__ */
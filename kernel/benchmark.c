@@ -0,0 +1,569 @@
+#include <DRIVER/timer.h>
+#include <DRIVER/video.h>
+
+#include <STD/stdlib.h>
+
+#include <SOARE/SOARE.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <benchmark.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+#include <kernel.h>
+
+/**
+ * @brief Loop-heavy script (arithmetic, strings and scopes)
+ *
+ */
+static char BENCHMARK_LOOP[] =
+    //
+    "let i = 0 "
+    "let s = '' "
+    "while i < 2000 do "
+    "  let t = i * 3 + 1 "
+    "  s = 'x', t "
+    "  i = i + 1 "
+    "end";
+//
+
+/**
+ * @brief Call-heavy script (recursion)
+ *
+ */
+static char BENCHMARK_CALLS[] =
+    //
+    "fn fib(n) "
+    "  if n < 2 do return n end "
+    "  return fib(n - 1) + fib(n - 2) "
+    "end "
+    "fib(20)";
+//
+
+/**
+ * @brief Generated code (eval in a loop)
+ *
+ */
+static char BENCHMARK_EVAL[] =
+    //
+    "let i = 0 "
+    "while i < 300 do "
+    "  eval('let a = i * 2 let b = a + 1 if b > 10 do a = b end') "
+    "  i = i + 1 "
+    "end";
+//
+
+/**
+ * @brief String built one character at a time (10,000 characters)
+ *
+ */
+static char BENCHMARK_BUILD[] =
+    //
+    "let s = '' "
+    "let i = 0 "
+    "while i < 10000 do "
+    "  s = s, chr(97 + i % 26) "
+    "  i = i + 1 "
+    "end";
+//
+
+/**
+ * @brief String read one character at a time (10,000 characters)
+ *
+ */
+static char BENCHMARK_SCAN[] =
+    //
+    "let s = '' "
+    "let i = 0 "
+    "while i < 1000 do s = s, 'abcdefghij' i = i + 1 end "
+    "let n = 0 "
+    "i = 0 "
+    "while i < 10000 do "
+    "  if s[i] == 'a' do n = n + 1 end "
+    "  i = i + 1 "
+    "end";
+//
+
+/**
+ * @brief Number of globals declared by BENCHMARK_GLOBALS
+ *
+ */
+#define BENCHMARK_GLOBALS_COUNT 1000
+
+/**
+ * @brief Generated code (many globals, then a loop reading them)
+ *
+ * @return char* (must be freed)
+ */
+static char *BENCHMARK_GLOBALS(void)
+{
+    // "let g999 = 999 " fits in 24 bytes
+    char *code = malloc(BENCHMARK_GLOBALS_COUNT * 24 + 128);
+    char number[12] = {0};
+
+    if (!code)
+        return NULL;
+
+    char *end = code;
+
+    for (int i = 0; i < BENCHMARK_GLOBALS_COUNT; i++)
+    {
+        itoa(number, sizeof(number), i);
+
+        strcpy(end, "let g");
+        strcat(end, number);
+        strcat(end, " = ");
+        strcat(end, number);
+        strcat(end, " ");
+
+        end += strlen(end);
+    }
+
+    strcpy(end, "let i = 0 "
+                "while i < 2000 do "
+                "  i = i + 1 + g0 - g500 + g500 "
+                "end");
+
+    return code;
+}
+
+/**
+ * @brief Number of statements of BENCHMARK_STATEMENTS
+ *
+ */
+#define BENCHMARK_STATEMENTS_COUNT 5000
+
+/**
+ * @brief Generated code (one long list of statements) for the parser
+ *
+ * @return char* (must be freed)
+ */
+static char *BENCHMARK_STATEMENTS(void)
+{
+    // "let p4999 = 4999 + 1 " fits in 24 bytes
+    char *code = malloc(BENCHMARK_STATEMENTS_COUNT * 24 + 1);
+    char number[12] = {0};
+
+    if (!code)
+        return NULL;
+
+    char *end = code;
+    *end = 0;
+
+    for (int i = 0; i < BENCHMARK_STATEMENTS_COUNT; i++)
+    {
+        itoa(number, sizeof(number), i);
+
+        strcpy(end, "let p");
+        strcat(end, number);
+        strcat(end, " = ");
+        strcat(end, number);
+        strcat(end, " + 1 ");
+
+        end += strlen(end);
+    }
+
+    return code;
+}
+
+/**
+ * @brief Size of the script generated by BENCHMARK_SOURCE
+ *
+ */
+#define BENCHMARK_SOURCE_SIZE 0x19000
+
+/**
+ * @brief Generated code (statements, strings and comments) for the tokenizer
+ *
+ * @return char* (must be freed)
+ */
+static char *BENCHMARK_SOURCE(void)
+{
+    static char line[] =
+        "let value_1 = 12.5 * (3 + x) <= 7 && name ~= 'it\\'s' "
+        "? comment\n"
+        "if value_1 >= 3 || y != 2 do write(\"a\\tb\"; `c`) end\n";
+
+    char *code = malloc(BENCHMARK_SOURCE_SIZE + sizeof(line));
+
+    if (!code)
+        return NULL;
+
+    size_t size = 0;
+
+    for (; size < BENCHMARK_SOURCE_SIZE; size += sizeof(line) - 1)
+        memmove(code + size, line, sizeof(line) - 1);
+
+    code[size] = 0;
+    return code;
+}
+
+/**
+ * @brief Print a column: label and value
+ *
+ * @param label
+ * @param value
+ */
+static void BENCHMARK_COLUMN(char *label, unsigned int value)
+{
+    char number[12] = {0};
+
+    PUTS(label);
+    PUTS(itoa(number, sizeof(number), (int)value));
+    PUTC(' ');
+}
+
+/**
+ * @brief Run a script on both engines and print allocations and cycles
+ *
+ * @param name
+ * @param code
+ */
+static void BENCHMARK_SCRIPT(char *name, char *code)
+{
+    soare_engine previous = soare_getengine();
+
+    // Parse once: both engines then run the cached program
+    free(Execute("benchmark", code));
+
+    for (soare_engine engine = ENGINE_TREE; engine <= ENGINE_BYTECODE; engine++)
+    {
+        soare_setengine(engine);
+
+        malloc_stats_t before = mstats();
+        unsigned long long cycles = RDTSC();
+
+        free(Execute("benchmark", code));
+
+        cycles = RDTSC() - cycles;
+        malloc_stats_t after = mstats();
+
+        PUTS("  ");
+        PUTS(name);
+        PUTS(engine == ENGINE_TREE ? "\ttree " : "\tvm   ");
+        BENCHMARK_COLUMN("malloc ", after.allocations - before.allocations);
+        BENCHMARK_COLUMN("small ", after.small - before.small);
+        BENCHMARK_COLUMN("free ", after.frees - before.frees);
+        // 64-bit division is not available: print kilo-cycles (x1024)
+        BENCHMARK_COLUMN("Kcycles ", (unsigned int)(cycles >> 10));
+        PUTC('\n');
+    }
+
+    soare_setengine(previous);
+}
+
+/**
+ * @brief Tokenize a large script and print its throughput
+ *
+ */
+static void BENCHMARK_TOKENIZER(void)
+{
+    char *code = BENCHMARK_SOURCE();
+
+    if (!code)
+        return;
+
+    Arena arena = {NULL};
+    Arena *previous = ARENA;
+    unsigned int count = 0;
+
+    ARENA = &arena;
+
+    unsigned long long cycles = RDTSC();
+    Tokens *tokens = Tokenizer("benchmark", code);
+    cycles = RDTSC() - cycles;
+
+    for (Tokens *token = tokens; token; token = token->next)
+        count++;
+
+    ARENA = previous;
+    ArenaFree(&arena);
+
+    unsigned int size = strlen(code);
+    unsigned int kcycles = (unsigned int)(cycles >> 10);
+
+    PUTS("  tokenizer\t");
+    BENCHMARK_COLUMN("bytes ", size);
+    BENCHMARK_COLUMN("tokens ", count);
+    BENCHMARK_COLUMN("Kcycles ", kcycles);
+    BENCHMARK_COLUMN("bytes/Kcycle ", kcycles ? size / kcycles : size);
+    PUTC('\n');
+
+    free(code);
+}
+
+/**
+ * @brief Parse a long list of statements and print its throughput
+ *
+ */
+static void BENCHMARK_PARSER(void)
+{
+    char *code = BENCHMARK_STATEMENTS();
+
+    if (!code)
+        return;
+
+    Arena arena = {NULL};
+    Arena *previous = ARENA;
+    unsigned int count = 0;
+
+    ARENA = &arena;
+
+    Tokens *tokens = Tokenizer("benchmark", code);
+
+    unsigned long long cycles = RDTSC();
+    AST tree = Parse(tokens);
+    cycles = RDTSC() - cycles;
+
+    for (AST statement = tree ? tree->child : NULL; statement; statement = statement->sibling)
+        count++;
+
+    ARENA = previous;
+    ArenaFree(&arena);
+
+    unsigned int kcycles = (unsigned int)(cycles >> 10);
+
+    PUTS("  parser\t");
+    BENCHMARK_COLUMN("statements ", count);
+    BENCHMARK_COLUMN("Kcycles ", kcycles);
+    BENCHMARK_COLUMN("cycles/statement ", count ? (kcycles << 10) / count : 0);
+    PUTC('\n');
+
+    free(code);
+}
+
+/**
+ * @brief Size of the buffers of BENCHMARK_MEMORY
+ *
+ */
+#define BENCHMARK_MEMORY_SIZE 0x10000
+
+/**
+ * @brief Runs of each function (1 MiB in total)
+ *
+ */
+#define BENCHMARK_MEMORY_RUNS 16
+
+/**
+ * @brief Print the throughput of a string or memory function
+ *
+ * @param name
+ * @param cycles
+ */
+static void BENCHMARK_RATE(char *name, unsigned long long cycles)
+{
+    // 64-bit division is not available: 1 MiB x 100 fits in 32 bits
+    unsigned int bytes = BENCHMARK_MEMORY_SIZE * BENCHMARK_MEMORY_RUNS;
+    unsigned int rate = cycles && cycles >> 32 == 0 ? bytes * 100 / (unsigned int)cycles : 0;
+    char number[12] = {0};
+
+    PUTS(name);
+    PUTS(itoa(number, sizeof(number), (int)(rate / 100)));
+    PUTC('.');
+    PUTC('0' + rate / 10 % 10);
+    PUTC('0' + rate % 10);
+    PUTC(' ');
+}
+
+/**
+ * @brief Measure the string and memory functions (bytes/cycle)
+ *
+ * @param label Functions used
+ * @param source String of BENCHMARK_MEMORY_SIZE bytes
+ * @param destination Buffer of 2 * BENCHMARK_MEMORY_SIZE bytes
+ */
+static void BENCHMARK_PRIMITIVES(char *label, char *source, char *destination)
+{
+    unsigned long long cycles[8] = {0};
+    unsigned long long start;
+    char *search = NULL;
+
+    for (int i = 0; i < BENCHMARK_MEMORY_RUNS; i++)
+    {
+        start = RDTSC();
+        strlen(source);
+        cycles[0] += RDTSC() - start;
+
+        start = RDTSC();
+        strcpy(destination, source);
+        cycles[1] += RDTSC() - start;
+
+        start = RDTSC();
+        strcmp(destination, source);
+        cycles[2] += RDTSC() - start;
+
+        // Not found: the whole string is read
+        start = RDTSC();
+        search = strchr(source, '!');
+        cycles[3] += RDTSC() - start;
+
+        *destination = 0;
+        start = RDTSC();
+        strcat(destination, source);
+        cycles[4] += RDTSC() - start;
+
+        start = RDTSC();
+        memcpy(destination, source, BENCHMARK_MEMORY_SIZE);
+        cycles[5] += RDTSC() - start;
+
+        // Overlapping blocks: copied backward
+        start = RDTSC();
+        memmove(destination + 4, destination, BENCHMARK_MEMORY_SIZE);
+        cycles[6] += RDTSC() - start;
+
+        start = RDTSC();
+        memset(destination, 0, BENCHMARK_MEMORY_SIZE);
+        cycles[7] += RDTSC() - start;
+    }
+
+    PUTS("  memory\t");
+    PUTS(label);
+    PUTS(search ? " (strchr failed) " : " ");
+    BENCHMARK_RATE("strlen ", cycles[0]);
+    BENCHMARK_RATE("strcpy ", cycles[1]);
+    BENCHMARK_RATE("strcmp ", cycles[2]);
+    BENCHMARK_RATE("strchr ", cycles[3]);
+    BENCHMARK_RATE("strcat ", cycles[4]);
+    PUTC('\n');
+    PUTS("  memory\t");
+    PUTS(label);
+    PUTC(' ');
+    BENCHMARK_RATE("memcpy ", cycles[5]);
+    BENCHMARK_RATE("memmove ", cycles[6]);
+    BENCHMARK_RATE("memset ", cycles[7]);
+    PUTC('\n');
+}
+
+/**
+ * @brief Measure the string and memory functions with each set of features
+ *
+ */
+static void BENCHMARK_MEMORY(void)
+{
+    char *source = malloc(BENCHMARK_MEMORY_SIZE + 1);
+    char *destination = malloc(2 * BENCHMARK_MEMORY_SIZE);
+
+    if (source && destination)
+    {
+        unsigned int features = stdlib_features();
+
+        for (unsigned int i = 0; i < BENCHMARK_MEMORY_SIZE; i++)
+            source[i] = 'a' + i % 26;
+        source[BENCHMARK_MEMORY_SIZE] = 0;
+
+        stdlib_init(0);
+        BENCHMARK_PRIMITIVES("word", source, destination);
+
+        if (features & STDLIB_SSE2)
+        {
+            stdlib_init(features);
+            BENCHMARK_PRIMITIVES("sse2", source, destination);
+        }
+
+        stdlib_init(features);
+    }
+
+    free(source);
+    free(destination);
+}
+
+/**
+ * @brief Lines printed by BENCHMARK_CONSOLE (each run)
+ *
+ */
+#define BENCHMARK_CONSOLE_LINES 50
+
+/**
+ * @brief Print a console throughput: characters per millisecond
+ *
+ * @param name
+ * @param characters
+ * @param cycles
+ */
+static void BENCHMARK_CHARS(char *name, unsigned int characters, unsigned long long cycles)
+{
+    unsigned int mhz = TIMER_TSC_KHZ() / 1000;
+
+    PUTS(name);
+
+    // 64-bit division is not available: microseconds in 32 bits
+    if (!mhz || cycles >> 32 || (unsigned int)cycles < mhz)
+    {
+        BENCHMARK_COLUMN("Kcycles ", (unsigned int)(cycles >> 10));
+        return;
+    }
+
+    BENCHMARK_COLUMN("chars/ms ", characters * 1000 / ((unsigned int)cycles / mhz));
+}
+
+/**
+ * @brief Print text on the console with PUTS, then with PUTC
+ *
+ */
+static void BENCHMARK_CONSOLE(void)
+{
+    static char line[] =
+        "The quick brown fox jumps over the lazy dog 0123456789 "
+        "!\"#$%&'()*+,-./:;<=>?@\n";
+
+    unsigned int characters = BENCHMARK_CONSOLE_LINES * (sizeof(line) - 1);
+
+    unsigned long long cycles = RDTSC();
+
+    for (int i = 0; i < BENCHMARK_CONSOLE_LINES; i++)
+        PUTS(line);
+
+    unsigned long long puts_cycles = RDTSC() - cycles;
+
+    cycles = RDTSC();
+
+    for (int i = 0; i < BENCHMARK_CONSOLE_LINES; i++)
+        for (char *c = line; *c; c++)
+            PUTC(*c);
+
+    unsigned long long putc_cycles = RDTSC() - cycles;
+
+    PUTS("  console\t");
+    BENCHMARK_COLUMN("chars ", characters);
+    BENCHMARK_CHARS("puts ", characters, puts_cycles);
+    BENCHMARK_CHARS("putc ", characters, putc_cycles);
+    PUTC('\n');
+}
+
+/**
+ * @brief Run the kernel benchmarks
+ *
+ */
+void BENCHMARK(void)
+{
+    PUTS("\n [ BENCHMARK ===== \n");
+
+    BENCHMARK_SCRIPT("loop", BENCHMARK_LOOP);
+    BENCHMARK_SCRIPT("calls", BENCHMARK_CALLS);
+    BENCHMARK_SCRIPT("eval", BENCHMARK_EVAL);
+    BENCHMARK_SCRIPT("build", BENCHMARK_BUILD);
+    BENCHMARK_SCRIPT("scan", BENCHMARK_SCAN);
+
+    char *globals = BENCHMARK_GLOBALS();
+
+    if (globals)
+        BENCHMARK_SCRIPT("globals", globals);
+
+    free(globals);
+
+    BENCHMARK_TOKENIZER();
+    BENCHMARK_PARSER();
+    BENCHMARK_MEMORY();
+    BENCHMARK_CONSOLE();
+
+    PUTC('\n');
+}
@@ -0,0 +1,195 @@
+#include <STD/stdlib.h>
+#include <STD/stdint.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <cpu.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+#include <cpu.h>
+
+// EFLAGS: the CPUID instruction exists if this bit can be changed
+#define EFLAGS_ID (1U << 21)
+
+// Features of the processor (filled by CPU_INIT)
+cpu_features_t CPU = {0};
+
+/**
+ * @brief Execute CPUID
+ *
+ * @param leaf
+ * @param registers EAX, EBX, ECX, EDX
+ */
+static inline void cpuid(uint32_t leaf, uint32_t registers[4])
+{
+    __asm__ volatile("cpuid"
+                     : "=a"(registers[0]), "=b"(registers[1]), "=c"(registers[2]), "=d"(registers[3])
+                     : "a"(leaf), "c"(0));
+}
+
+/**
+ * @brief Check if the CPUID instruction exists (EFLAGS.ID can be toggled)
+ *
+ * @return unsigned char
+ */
+static unsigned char cpuid_available(void)
+{
+    uint32_t before, after;
+
+    __asm__ volatile("pushfl\n\t"
+                     "pushfl\n\t"
+                     "popl %0\n\t"
+                     "movl %0, %1\n\t"
+                     "xorl %2, %1\n\t"
+                     "pushl %1\n\t"
+                     "popfl\n\t"
+                     "pushfl\n\t"
+                     "popl %1\n\t"
+                     "popfl"
+                     : "=&r"(before), "=&r"(after)
+                     : "i"(EFLAGS_ID)
+                     : "cc");
+
+    return ((before ^ after) & EFLAGS_ID) != 0;
+}
+
+/**
+ * @brief Read the processor identification and features
+ *
+ */
+static void cpu_detect(void)
+{
+    uint32_t registers[4];
+
+    CPU.cpuid = cpuid_available();
+
+    if (!CPU.cpuid)
+        return;
+
+    // Leaf 0: highest leaf and vendor (EBX, EDX, ECX)
+    cpuid(0, registers);
+    CPU.leaves = registers[0];
+
+    memcpy(CPU.vendor, &registers[1], 4);
+    memcpy(CPU.vendor + 4, &registers[3], 4);
+    memcpy(CPU.vendor + 8, &registers[2], 4);
+    CPU.vendor[12] = 0;
+
+    if (CPU.leaves < 1)
+        return;
+
+    // Leaf 1: signature and features
+    cpuid(1, registers);
+
+    uint32_t signature = registers[0];
+    uint32_t ecx = registers[2];
+    uint32_t edx = registers[3];
+
+    CPU.stepping = signature & 0xF;
+    CPU.model = (signature >> 4) & 0xF;
+    CPU.family = (signature >> 8) & 0xF;
+
+    if (CPU.family == 0x6 || CPU.family == 0xF)
+        CPU.model |= ((signature >> 16) & 0xF) << 4;
+    if (CPU.family == 0xF)
+        CPU.family += (signature >> 20) & 0xFF;
+
+    CPU.fpu = (edx >> 0) & 1;
+    CPU.tsc = (edx >> 4) & 1;
+    CPU.mmx = (edx >> 23) & 1;
+    CPU.fxsr = (edx >> 24) & 1;
+    CPU.sse = (edx >> 25) & 1;
+    CPU.sse2 = (edx >> 26) & 1;
+
+    CPU.sse3 = (ecx >> 0) & 1;
+    CPU.ssse3 = (ecx >> 9) & 1;
+    CPU.sse41 = (ecx >> 19) & 1;
+    CPU.sse42 = (ecx >> 20) & 1;
+    CPU.popcnt = (ecx >> 23) & 1;
+    CPU.avx = (ecx >> 28) & 1;
+}
+
+/**
+ * @brief Enable the x87 FPU, then SSE if the processor has it
+ *
+ */
+static void fpu_enable(void)
+{
+    uint32_t cr0, cr4;
+
+    // Without CPUID, the FPU is not probed: it stays disabled
+    if (!CPU.fpu)
+        return;
+
+    __asm__ volatile("movl %%cr0, %0" : "=r"(cr0));
+    cr0 &= ~(CR0_EM | CR0_TS);
+    cr0 |= CR0_MP | CR0_NE;
+    __asm__ volatile("movl %0, %%cr0" : : "r"(cr0));
+
+    // Default control word: every x87 exception masked
+    __asm__ volatile("fninit");
+    CPU.x87_enabled = 1;
+
+    // fxsave/fxrstor are needed to save the SSE registers
+    if (!CPU.sse || !CPU.fxsr)
+        return;
+
+    __asm__ volatile("movl %%cr4, %0" : "=r"(cr4));
+    cr4 |= CR4_OSFXSR | CR4_OSXMMEXCPT;
+    __asm__ volatile("movl %0, %%cr4" : : "r"(cr4));
+
+    uint32_t mxcsr = MXCSR_DEFAULT;
+    __asm__ volatile("ldmxcsr %0" : : "m"(mxcsr));
+    CPU.sse_enabled = 1;
+}
+
+/**
+ * @brief Detect the processor features, enable the FPU and SSE
+ *
+ */
+void CPU_INIT(void)
+{
+    cpu_detect();
+    fpu_enable();
+
+    // Fast string and memory functions
+    stdlib_init(CPU.sse_enabled && CPU.sse2 ? STDLIB_SSE2 : 0);
+}
+
+/**
+ * @brief Save the FPU/SSE state
+ *
+ * @param state
+ */
+void FPU_SAVE(fpu_state_t *state)
+{
+    if (CPU.sse_enabled)
+        __asm__ volatile("fxsave %0" : "=m"(*state));
+    else if (CPU.x87_enabled)
+        // fnsave also resets the FPU: load the state back
+        __asm__ volatile("fnsave %0\n\t"
+                         "frstor %0"
+                         : "+m"(*state));
+}
+
+/**
+ * @brief Restore a FPU/SSE state
+ *
+ * @param state
+ */
+void FPU_RESTORE(fpu_state_t *state)
+{
+    if (CPU.sse_enabled)
+        __asm__ volatile("fxrstor %0" : : "m"(*state));
+    else if (CPU.x87_enabled)
+        __asm__ volatile("frstor %0" : : "m"(*state));
+}
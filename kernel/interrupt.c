@@ -0,0 +1,413 @@
+#include <DRIVER/video.h>
+#include <DRIVER/io.h>
+
+#include <STD/stdlib.h>
+#include <STD/stdint.h>
+
+#include <cpu.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <interrupt.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+#include <interrupt.h>
+
+// Master PIC (IRQ 0-7)
+#define PIC1_COMMAND 0x20
+#define PIC1_DATA 0x21
+// Slave PIC (IRQ 8-15, chained on IRQ 2)
+#define PIC2_COMMAND 0xA0
+#define PIC2_DATA 0xA1
+
+// PIC commands
+#define PIC_INIT 0x11
+#define PIC_8086 0x01
+#define PIC_EOI 0x20
+#define PIC_READ_ISR 0x0B
+
+// IRQ of the slave PIC on the master PIC
+#define IRQ_CASCADE 2
+
+// Present, ring 0, 32-bit interrupt gate (IF cleared on entry)
+#define IDT_INTERRUPT_GATE 0x8E
+
+// Vectors with a stub: CPU exceptions and IRQs
+#define INTERRUPT_STUBS (IRQ_BASE + IRQ_COUNT)
+
+/**
+ * @brief Segment descriptor
+ */
+typedef struct gdt_entry
+{
+
+    uint16_t limit_low;
+    uint16_t base_low;
+    uint8_t base_middle;
+    uint8_t access;
+    uint8_t granularity;
+    uint8_t base_high;
+
+} __attribute__((packed)) gdt_entry_t;
+
+/**
+ * @brief Interrupt descriptor
+ */
+typedef struct idt_entry
+{
+
+    uint16_t offset_low;
+    uint16_t selector;
+    uint8_t zero;
+    uint8_t flags;
+    uint16_t offset_high;
+
+} __attribute__((packed)) idt_entry_t;
+
+/**
+ * @brief Operand of lgdt and lidt
+ */
+typedef struct descriptor_table
+{
+
+    uint16_t limit;
+    uint32_t base;
+
+} __attribute__((packed)) descriptor_table_t;
+
+// Flat segments: the GDT set by the bootloader may be gone
+static gdt_entry_t GDT[] = {
+    // Null descriptor
+    {0, 0, 0, 0, 0, 0},
+    // Kernel code: base 0, limit 4 GiB, ring 0, readable
+    {0xFFFF, 0, 0, 0x9A, 0xCF, 0},
+    // Kernel data: base 0, limit 4 GiB, ring 0, writable
+    {0xFFFF, 0, 0, 0x92, 0xCF, 0},
+};
+
+// Interrupt descriptors (vectors without stub are not present)
+static idt_entry_t IDT[256];
+
+// Handlers of the hardware interrupts
+static irq_handler_t IRQ_HANDLERS[IRQ_COUNT];
+
+// IRQ masks (1: masked); the cascade is always open
+static uint16_t IRQ_MASK = 0xFFFF & ~(1U << IRQ_CASCADE);
+
+// Names of the CPU exceptions
+static const char *EXCEPTIONS[] = {
+    "division error",
+    "debug",
+    "non-maskable interrupt",
+    "breakpoint",
+    "overflow",
+    "bound range exceeded",
+    "invalid opcode",
+    "device not available",
+    "double fault",
+    "coprocessor segment overrun",
+    "invalid TSS",
+    "segment not present",
+    "stack-segment fault",
+    "general protection fault",
+    "page fault",
+    "reserved",
+    "x87 floating-point exception",
+    "alignment check",
+    "machine check",
+    "SIMD floating-point exception",
+};
+
+/**
+ * @brief Called by the interrupt stubs
+ *
+ * @param frame
+ */
+void interrupt_dispatch(interrupt_frame_t *frame);
+
+/**
+ * Interrupt stubs: each pushes an error code (if the CPU gives none)
+ * and its vector, then interrupt_common saves the registers and calls
+ * interrupt_dispatch with the frame.
+ *
+ * Vectors 8, 10-14, 17, 21, 29 and 30 come with an error code.
+ */
+__asm__(
+    //
+    ".text\n"
+    "interrupt_common:\n"
+    "    pusha\n"
+    "    cld\n"
+    "    pushl %esp\n"
+    "    call interrupt_dispatch\n"
+    "    addl $4, %esp\n"
+    "    popa\n"
+    "    addl $8, %esp\n"
+    "    iret\n"
+    ".irp n, 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,"
+    "24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47\n"
+    "interrupt_stub\\n:\n"
+    ".if (\\n != 8) && (\\n < 10 || \\n > 14) && \\n != 17 && \\n != 21 && \\n != 29 && \\n != 30\n"
+    "    pushl $0\n"
+    ".endif\n"
+    "    pushl $\\n\n"
+    "    jmp interrupt_common\n"
+    ".endr\n"
+    ".section .rodata\n"
+    ".align 4\n"
+    "interrupt_stubs:\n"
+    ".irp n, 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,"
+    "24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47\n"
+    "    .long interrupt_stub\\n\n"
+    ".endr\n"
+    ".text\n"
+    //
+);
+
+// Addresses of the stubs (see above)
+extern const uint32_t interrupt_stubs[INTERRUPT_STUBS];
+
+/**
+ * @brief Short pause between PIC commands (write to an unused port)
+ *
+ */
+static inline void io_wait(void)
+{
+    OUTB(0x80, 0);
+}
+
+/**
+ * @brief Write the IRQ masks to the PICs
+ *
+ */
+static void pic_mask(void)
+{
+    OUTB(PIC1_DATA, IRQ_MASK & 0xFF);
+    OUTB(PIC2_DATA, IRQ_MASK >> 8);
+}
+
+/**
+ * @brief Move the IRQs after the CPU exceptions (IRQ_BASE)
+ *
+ */
+static void pic_remap(void)
+{
+    OUTB(PIC1_COMMAND, PIC_INIT);
+    io_wait();
+    OUTB(PIC2_COMMAND, PIC_INIT);
+    io_wait();
+
+    // Vector offsets
+    OUTB(PIC1_DATA, IRQ_BASE);
+    io_wait();
+    OUTB(PIC2_DATA, IRQ_BASE + 8);
+    io_wait();
+
+    // Slave on the cascade IRQ
+    OUTB(PIC1_DATA, 1 << IRQ_CASCADE);
+    io_wait();
+    OUTB(PIC2_DATA, IRQ_CASCADE);
+    io_wait();
+
+    OUTB(PIC1_DATA, PIC_8086);
+    io_wait();
+    OUTB(PIC2_DATA, PIC_8086);
+    io_wait();
+
+    pic_mask();
+}
+
+/**
+ * @brief Check if an IRQ 7 or 15 was raised without a device (spurious)
+ *
+ * @param irq
+ * @return unsigned char
+ */
+static unsigned char pic_spurious(unsigned char irq)
+{
+    if (irq != 7 && irq != 15)
+        return 0;
+
+    unsigned short command = irq == 7 ? PIC1_COMMAND : PIC2_COMMAND;
+
+    // A real IRQ is marked in the in-service register
+    OUTB(command, PIC_READ_ISR);
+
+    if (INB(command) & 0x80)
+        return 0;
+
+    // The master PIC did see the slave interrupt
+    if (irq == 15)
+        OUTB(PIC1_COMMAND, PIC_EOI);
+
+    return 1;
+}
+
+/**
+ * @brief Signal the end of an IRQ to the PICs
+ *
+ * @param irq
+ */
+static inline void pic_eoi(unsigned char irq)
+{
+    if (irq >= 8)
+        OUTB(PIC2_COMMAND, PIC_EOI);
+    OUTB(PIC1_COMMAND, PIC_EOI);
+}
+
+/**
+ * @brief Print a number in hexadecimal (8 digits)
+ *
+ * @param value
+ */
+static void panic_hex(uint32_t value)
+{
+    PUTS("0x");
+    for (int shift = 28; shift >= 0; shift -= 4)
+        PUTC("0123456789ABCDEF"[(value >> shift) & 0xF]);
+}
+
+/**
+ * @brief Report a CPU exception and stop the kernel
+ *
+ * @param frame
+ */
+static void interrupt_panic(interrupt_frame_t *frame)
+{
+    char number[12] = {0};
+
+    CPUTS("\n [ EXCEPTION ===== \n", 0x4F);
+
+    PUTS(" \t ");
+    PUTS(frame->vector < sizeof(EXCEPTIONS) / sizeof(EXCEPTIONS[0]) ? (char *)EXCEPTIONS[frame->vector] : "reserved");
+    PUTS(" (");
+    PUTS(itoa(number, sizeof(number), (int)frame->vector));
+    PUTS(")\n \t eip   ");
+    panic_hex(frame->eip);
+    PUTS("\n \t error ");
+    panic_hex(frame->error);
+    PUTS("\n\n SYSTEM HALTED\n");
+
+    for (;;)
+        __asm__ volatile("cli\n\t"
+                         "hlt");
+}
+
+/**
+ * @brief Called by the interrupt stubs
+ *
+ * @param frame
+ */
+void interrupt_dispatch(interrupt_frame_t *frame)
+{
+    if (frame->vector < IRQ_BASE)
+        return interrupt_panic(frame);
+
+    unsigned char irq = frame->vector - IRQ_BASE;
+
+    if (pic_spurious(irq))
+        return;
+
+    if (IRQ_HANDLERS[irq])
+    {
+        // The handler may use the FPU/SSE registers (see stdlib_init) of
+        // the interrupted code: IRQs do not nest (interrupt gates)
+        static fpu_state_t state;
+
+        FPU_SAVE(&state);
+        IRQ_HANDLERS[irq]();
+        FPU_RESTORE(&state);
+    }
+
+    pic_eoi(irq);
+}
+
+/**
+ * @brief Load the flat GDT and reload the segment registers
+ *
+ */
+static void gdt_load(void)
+{
+    descriptor_table_t gdtr = {sizeof(GDT) - 1, (uint32_t)GDT};
+
+    __asm__ volatile("lgdt %0\n\t"
+                     "ljmp %1, $1f\n"
+                     "1:\n\t"
+                     "movw %2, %%ax\n\t"
+                     "movw %%ax, %%ds\n\t"
+                     "movw %%ax, %%es\n\t"
+                     "movw %%ax, %%fs\n\t"
+                     "movw %%ax, %%gs\n\t"
+                     "movw %%ax, %%ss"
+                     :
+                     : "m"(gdtr), "i"(GDT_CODE), "i"(GDT_DATA)
+                     : "eax", "memory");
+}
+
+/**
+ * @brief Fill the IDT with the stubs and load it
+ *
+ */
+static void idt_load(void)
+{
+    for (int vector = 0; vector < INTERRUPT_STUBS; vector++)
+    {
+        uint32_t offset = interrupt_stubs[vector];
+
+        IDT[vector].offset_low = offset & 0xFFFF;
+        IDT[vector].selector = GDT_CODE;
+        IDT[vector].zero = 0;
+        IDT[vector].flags = IDT_INTERRUPT_GATE;
+        IDT[vector].offset_high = offset >> 16;
+    }
+
+    descriptor_table_t idtr = {sizeof(IDT) - 1, (uint32_t)IDT};
+    __asm__ volatile("lidt %0" : : "m"(idtr));
+}
+
+/**
+ * @brief Load the GDT and the IDT, remap the PIC and enable interrupts
+ *
+ */
+void INTERRUPT_INIT(void)
+{
+    gdt_load();
+    idt_load();
+    pic_remap();
+
+    __asm__ volatile("sti");
+}
+
+/**
+ * @brief Install the handler of an IRQ and unmask it
+ *
+ * @param irq
+ * @param handler
+ */
+void IRQ_INSTALL(unsigned char irq, irq_handler_t handler)
+{
+    if (irq >= IRQ_COUNT)
+        return;
+
+    __asm__ volatile("cli");
+
+    IRQ_HANDLERS[irq] = handler;
+
+    if (handler)
+        IRQ_MASK &= ~(1U << irq);
+    else if (irq != IRQ_CASCADE)
+        IRQ_MASK |= 1U << irq;
+
+    pic_mask();
+
+    __asm__ volatile("sti");
+}
@@ -1,5 +1,6 @@
 #include <DRIVER/keyboard.h>
 #include <DRIVER/speaker.h>
+#include <DRIVER/timer.h>
 #include <DRIVER/video.h>
 
 #include <STD/stdlib.h>
@@ -22,6 +23,10 @@
  */
 
 #include <kernel.h>
+#include <cpu.h>
+#include <interrupt.h>
+#include <pmm.h>
+#include <stack.h>
 
 // Indicates if the kernel main loop is running.
 unsigned char running = 0;
@@ -140,9 +145,6 @@ static void KEYBOARD_SELECTOR(void)
     UPDATE_AND_MOVE_CURSOR(0);
     uint16_t cursor = GET_CURSOR();
 
-    while (INB(KEYBOARD_PORT) == SCANCODE_ENTER)
-        /* pass */;
-
     while (1)
     {
         PUTS("      \t 1) ");
@@ -150,7 +152,8 @@ static void KEYBOARD_SELECTOR(void)
         PUTS("      \t 2) ");
         CPUTS(" AZERTY \n", selected == AZERTY ? 0x9F : 0xF1);
 
-        switch (INB(KEYBOARD_PORT))
+        // Releases and other keys only redraw the menu
+        switch (KEYBOARD_READ())
         {
         case SCANCODE_UP:
             selected = QWERTY;
@@ -161,10 +164,6 @@ static void KEYBOARD_SELECTOR(void)
             break;
 
         case SCANCODE_ENTER:
-
-            while (INB(KEYBOARD_PORT) == SCANCODE_ENTER)
-                /* Wait for release */;
-
             PUTS("\n Keyboard (");
             PUTC('0' + selected + 1);
             PUTS(") selected !\n");
@@ -348,9 +347,28 @@ static void shell()
 /**
  * @brief Start the kernel
  *
+ * @param magic
+ * @param info
  */
-void start(void)
+void start(unsigned int magic, multiboot_info_t *info)
 {
+    // Physical memory (feeds malloc)
+    PMM_INIT(magic, info);
+    // Stack high-water mark (see stackinfo): painted once the multiboot
+    // information, which may lie below the stack, has been read
+    STACK_INIT();
+    // CPU features, FPU and SSE (selects the fast stdlib functions)
+    CPU_INIT();
+    // Exceptions and hardware interrupts
+    INTERRUPT_INIT();
+    // Keystrokes are buffered by IRQ1
+    KEYBOARD_FLUSH();
+    IRQ_INSTALL(IRQ_KEYBOARD, KEYBOARD_IRQ);
+    // 1 ms ticks (SLEEP, uptime) and the TSC frequency
+    TIMER_INIT();
+    IRQ_INSTALL(IRQ_TIMER, TIMER_IRQ);
+    TIMER_CALIBRATE();
+
     // Statup screen
     STARTUP_SCREEN();
     STARTUP_SOUND();
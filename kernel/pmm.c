@@ -0,0 +1,255 @@
+#include <STD/stdlib.h>
+#include <STD/stdint.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <pmm.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+#include <pmm.h>
+
+// End of the kernel image (see script/linker.ld)
+extern char __kernel_end[];
+
+// One bit per page frame (1: used or not RAM, 0: free)
+static uint32_t FRAMES[PMM_MAX_FRAMES / 32];
+
+// Usable frames
+static size_t TOTAL_FRAMES = 0;
+// Free frames
+static size_t FREE_FRAMES = 0;
+
+// First frame that may be free (search hint)
+static size_t NEXT_FRAME = 0;
+
+// The heap grows by at least this many bytes
+#define HEAP_GROWTH 0x10000
+
+/**
+ * @brief Is the frame used
+ *
+ * @param frame
+ * @return unsigned char
+ */
+static inline unsigned char frame_used(size_t frame)
+{
+    return (FRAMES[frame / 32] >> (frame % 32)) & 1;
+}
+
+/**
+ * @brief Mark a range of frames as free or used
+ *
+ * @param frame
+ * @param count
+ * @param used
+ */
+static void frame_mark(size_t frame, size_t count, unsigned char used)
+{
+    for (; count && frame < PMM_MAX_FRAMES; frame++, count--)
+    {
+        if (frame_used(frame) == used)
+            continue;
+
+        if (used)
+        {
+            FRAMES[frame / 32] |= 1U << (frame % 32);
+            FREE_FRAMES--;
+        }
+        else
+        {
+            FRAMES[frame / 32] &= ~(1U << (frame % 32));
+            FREE_FRAMES++;
+        }
+    }
+}
+
+/**
+ * @brief Give a range of physical memory to the allocator
+ *
+ * @param addr
+ * @param len
+ */
+static void pmm_region(unsigned long long addr, unsigned long long len)
+{
+    // Whole frames inside the region, below 4 GiB
+    unsigned long long first = (addr + PAGE_SIZE - 1) / PAGE_SIZE;
+    unsigned long long last = (addr + len) / PAGE_SIZE;
+
+    if (last > PMM_MAX_FRAMES)
+        last = PMM_MAX_FRAMES;
+
+    if (first >= last)
+        return;
+
+    frame_mark((size_t)first, (size_t)(last - first), 0);
+}
+
+/**
+ * @brief Take a range of physical memory back from the allocator
+ *
+ * @param start
+ * @param end
+ */
+static void pmm_reserve(uintptr_t start, uintptr_t end)
+{
+    size_t first = start / PAGE_SIZE;
+    size_t last = (end + PAGE_SIZE - 1) / PAGE_SIZE;
+
+    if (last > first)
+        frame_mark(first, last - first, 1);
+}
+
+/**
+ * @brief Build the page-frame allocator from the multiboot memory map
+ *
+ * @param magic
+ * @param info
+ */
+void PMM_INIT(unsigned int magic, multiboot_info_t *info)
+{
+    // Every frame starts as used, RAM regions are then released
+    for (size_t i = 0; i < PMM_MAX_FRAMES / 32; i++)
+        FRAMES[i] = 0xFFFFFFFF;
+
+    if (magic != MULTIBOOT_BOOTLOADER_MAGIC || !info)
+        // No information: assume the first 4 MiB
+        pmm_region(0, 0x400000);
+
+    else if (info->flags & MULTIBOOT_INFO_MEM_MAP)
+    {
+        uintptr_t entry = info->mmap_addr;
+        uintptr_t end = info->mmap_addr + info->mmap_length;
+
+        for (; entry < end; entry += ((multiboot_mmap_entry_t *)entry)->size + sizeof(uint32_t))
+        {
+            multiboot_mmap_entry_t *region = (multiboot_mmap_entry_t *)entry;
+
+            if (region->type == MULTIBOOT_MEMORY_AVAILABLE)
+                pmm_region(region->addr, region->len);
+        }
+    }
+
+    else if (info->flags & MULTIBOOT_INFO_MEMORY)
+        pmm_region(0x100000, (unsigned long long)info->mem_upper * 1024);
+
+    // Real mode area, BIOS, VGA and the boot stack (below 0x90000)
+    pmm_reserve(0, 0x100000);
+    // Kernel image
+    pmm_reserve(0x100000, (uintptr_t)__kernel_end);
+
+    // Multiboot structures
+    if (magic == MULTIBOOT_BOOTLOADER_MAGIC && info)
+    {
+        pmm_reserve((uintptr_t)info, (uintptr_t)info + sizeof(multiboot_info_t));
+        if (info->flags & MULTIBOOT_INFO_MEM_MAP)
+            pmm_reserve(info->mmap_addr, info->mmap_addr + info->mmap_length);
+    }
+
+    TOTAL_FRAMES = FREE_FRAMES;
+    NEXT_FRAME = 0;
+}
+
+/**
+ * @brief Allocate contiguous physical page frames
+ *
+ * @param count
+ * @return void* (NULL if there is no such range)
+ */
+void *PAGE_ALLOC(size_t count)
+{
+    if (!count || count > FREE_FRAMES)
+        return NULL;
+
+    size_t run = 0;
+
+    for (size_t frame = NEXT_FRAME; frame < PMM_MAX_FRAMES; frame++)
+    {
+        // Skip fully used words
+        if (!run && !(frame % 32) && FRAMES[frame / 32] == 0xFFFFFFFF)
+        {
+            frame += 31;
+            continue;
+        }
+
+        run = frame_used(frame) ? 0 : run + 1;
+
+        if (run < count)
+            continue;
+
+        size_t first = frame + 1 - count;
+        frame_mark(first, count, 1);
+
+        if (first == NEXT_FRAME)
+            NEXT_FRAME = frame + 1;
+
+        return (void *)(first * PAGE_SIZE);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Release page frames
+ *
+ * @param address
+ * @param count
+ */
+void PAGE_FREE(void *address, size_t count)
+{
+    size_t frame = (uintptr_t)address / PAGE_SIZE;
+
+    frame_mark(frame, count, 0);
+
+    if (frame < NEXT_FRAME)
+        NEXT_FRAME = frame;
+}
+
+/**
+ * @brief Number of usable page frames
+ *
+ * @return size_t
+ */
+size_t PMM_TOTAL_FRAMES(void)
+{
+    return TOTAL_FRAMES;
+}
+
+/**
+ * @brief Number of free page frames
+ *
+ * @return size_t
+ */
+size_t PMM_FREE_FRAMES(void)
+{
+    return FREE_FRAMES;
+}
+
+/**
+ * @brief Give more memory to malloc
+ *
+ * @param size
+ * @param granted
+ * @return void*
+ */
+void *morecore(size_t size, size_t *granted)
+{
+    if (size < HEAP_GROWTH)
+        size = HEAP_GROWTH;
+
+    size_t count = (size + PAGE_SIZE - 1) / PAGE_SIZE;
+    void *region = PAGE_ALLOC(count);
+
+    if (region)
+        *granted = count * PAGE_SIZE;
+
+    return region;
+}
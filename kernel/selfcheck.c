@@ -0,0 +1,197 @@
+#include <DRIVER/video.h>
+
+#include <STD/stdlib.h>
+
+#include <SOARE/SOARE.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <selfcheck.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+#include <kernel.h>
+
+/**
+ * @brief Scripts run by both engines (name, code)
+ *
+ * Each script returns a string describing what it did.
+ */
+static char *SELFCHECK_SCRIPTS[][2] = {
+
+    {"operators",
+     "let r = 1 + 2 * 3 - 4 / 2 "
+     "r = r, ' ', 7 % 3, ' ', 5 ^ 1, ' ', 0 - 7 / 2, ' ' "
+     "let c = 3 <= 3 r = r, c "
+     "c = 4 >= 5 r = r, c "
+     "c = 2 < 1 r = r, c "
+     "c = 'a' != 'b' r = r, c "
+     "c = 'a' ~= 'a' r = r, c "
+     "c = 12 == '12' r = r, c "
+     "c = 1 && 0 r = r, c "
+     "c = 1 || 0 r = r, c "
+     "return r"},
+
+    {"strings",
+     "let s = 'hello' "
+     "let r = s[1], s[0 - 1], 'abc'[2], s[1 + 1] "
+     "try let t = s[9] r = r, t iferror r = r, '!' end "
+     "fn f() s = 'HI' return 1 end "
+     "r = r, s[f()], s "
+     "return r, chr(65), ord('A'), '\\x41\\t|'"},
+
+    {"slices",
+     "return slice('hello'; 1; 3), '|', slice('hello'; 0 - 2; 9), '|', slice('hello'; 3; 1), '|', "
+     "slice('hello'; 9; 12), '|', slice('hello'; 0 - 9; 2), '|', slice('hello'; 1; 0 - 1)"},
+
+    {"append",
+     "let s = 'ab' "
+     "fn f() s = 'x' return 'y' end "
+     "s = s, f() let r = s, ' ' "
+     "s = 'ab' s = s, s r = r, s, ' ' "
+     "s = 'ab' s = s, s[0] r = r, s, ' ' "
+     "s = 'ab' s = s, s, s[1] r = r, s "
+     "return r"},
+
+    {"append-null",
+     "let s = 'ab' "
+     "fn noret() let z = 1 end "
+     "s = s, noret() "
+     "return s"},
+
+    {"append-error",
+     "let s = 'ab' "
+     "s = s, nope "
+     "return s"},
+
+    {"conditions",
+     "let r = '' "
+     "if 1 == 2 do r = r, 'a' or 2 == 2 do r = r, 'b' else r = r, 'c' end "
+     "if 0 do r = r, 'd' else r = r, 'e' end "
+     "if 0 do r = r, 'f' or 0 do r = r, 'g' end "
+     "if 1 do let t = 'h' r = r, t end "
+     "return r"},
+
+    {"loops",
+     "let r = '' let i = 0 "
+     "while i < 10 do let t = i * 2 r = r, t i = i + 1 end "
+     "let j = 0 "
+     "while 1 do j = j + 1 if j > 5 do break end end "
+     "let k = 0 "
+     "while k < 3 do k = k + 1 end "
+     "return r, ' ', i, j, k"},
+
+    {"functions",
+     "fn fib(n) if n < 2 do return n end return fib(n - 1) + fib(n - 2) end "
+     "fn twice(f; x) return f(f(x)) end "
+     "fn inc(x) return x + 1 end "
+     "fn noret() let z = 1 end "
+     "fn early(n) while 1 do if n > 2 do return n end n = n + 1 end end "
+     "fn loud() if 1 do return noret() end return 'x' end "
+     "let a = 1 "
+     "fn g() return a end "
+     "fn h() let a = 3 return g() end "
+     "noret() "
+     "return fib(12), ' ', twice(inc; 5), ' ', early(0), ' ', h(), g(), ' ', loud()"},
+
+    {"exceptions",
+     "let r = '' "
+     "try raise 'boom' iferror r = r, 'a' end "
+     "try let x = nope r = r, 'b' iferror r = r, 'c' end "
+     "try let y = 1 / 0 iferror r = r, 'd' end "
+     "fn f() try return 'e' iferror return 'f' end end "
+     "r = r, f() "
+     "try try raise 'in' iferror raise 'out' end iferror r = r, 'g' end "
+     "return r"},
+
+    {"eval",
+     "let r = eval('return 6 * 7') "
+     "let i = 0 "
+     "while i < 3 do r = r, eval('return i') i = i + 1 end "
+     "return r, eval('fn f(x) return x, x end return f(4)')"},
+
+    {"errors",
+     "let r = 'a' "
+     "r = r, undefined "
+     "return r"},
+
+};
+
+/**
+ * @brief Run a script on an engine
+ *
+ * @param engine
+ * @param code
+ * @param errorlevel
+ * @return char*
+ */
+static char *SELFCHECK_RUN(soare_engine engine, char *code, char *errorlevel)
+{
+    soare_engine previous = soare_getengine();
+    unsigned char ignored = AsIgnoredException();
+
+    soare_setengine(engine);
+    IgnoreException(1);
+
+    char *result = Execute("selfcheck", code);
+    *errorlevel = ErrorLevel();
+
+    IgnoreException(ignored);
+    ClearException();
+    soare_setengine(previous);
+
+    return result;
+}
+
+/**
+ * @brief Run every script on both engines and compare the results
+ *
+ */
+void SELFCHECK(void)
+{
+    unsigned int failed = 0;
+
+    PUTS("\n [ SELFCHECK ===== \n");
+
+    for (size_t i = 0; i < sizeof(SELFCHECK_SCRIPTS) / sizeof(SELFCHECK_SCRIPTS[0]); i++)
+    {
+        char tree_error = 0, bytecode_error = 0;
+
+        char *tree = SELFCHECK_RUN(ENGINE_TREE, SELFCHECK_SCRIPTS[i][1], &tree_error);
+        char *bytecode = SELFCHECK_RUN(ENGINE_BYTECODE, SELFCHECK_SCRIPTS[i][1], &bytecode_error);
+
+        unsigned char same = tree_error == bytecode_error;
+
+        if (same && tree && bytecode)
+            same = !strcmp(tree, bytecode);
+        else if (same)
+            same = tree == bytecode;
+
+        PUTS("  ");
+        PUTS(SELFCHECK_SCRIPTS[i][0]);
+        PUTS(same ? "\tok " : "\tFAIL ");
+        PUTS(tree ? tree : "(null)");
+
+        if (!same)
+        {
+            PUTS(" / ");
+            PUTS(bytecode ? bytecode : "(null)");
+            failed++;
+        }
+
+        PUTC('\n');
+
+        free(tree);
+        free(bytecode);
+    }
+
+    PUTS(failed ? "  engines differ\n\n" : "  engines agree\n\n");
+}
@@ -1,5 +1,6 @@
 #include <DRIVER/keyboard.h>
 #include <DRIVER/speaker.h>
+#include <DRIVER/timer.h>
 #include <DRIVER/video.h>
 
 #include <STD/stdlib.h>
@@ -21,6 +22,9 @@
  */
 
 #include <kernel.h>
+#include <cpu.h>
+#include <pmm.h>
+#include <stack.h>
 
 /**
  * @brief Show help information
@@ -32,12 +36,19 @@ void kw_help(void)
         //
         "\n"
         " [ HELP - BORIUM / SOARE KERNEL ===== \n"
+        " \t benchmark          <keyword>  Run kernel benchmarks \n"
+        " \t cacheinfo          <keyword>  Show parsed program cache \n"
         " \t clear              <keyword>  Clear screen \n"
+        " \t cpuinfo            <keyword>  Show processor features \n"
         " \t editor             <keyword>  Text editor \n"
         " \t help               <keyword>  Show commands \n"
         " \t license            <keyword>  Show license \n"
+        " \t meminfo            <keyword>  Show heap usage \n"
         " \t pause              <keyword>  Interrupts the execution \n"
+        " \t selfcheck          <keyword>  Compare the SOARE engines \n"
         " \t setup              <keyword>  Change BORIUM settings \n"
+        " \t stackinfo          <keyword>  Show kernel stack usage \n"
+        " \t uptime             <keyword>  Show time since boot \n"
         " \t chr(ascii_code)    <function> Character from ASCII code \n"
         " \t color(vga_color)   <function> Text color \n"
         " \t cursor(x; y)       <function> Set cursor location \n"
@@ -48,6 +59,7 @@ void kw_help(void)
         " \t ord(character)     <function> ASCII code from character \n"
         " \t play_note(freq; t) <function> Play frequency (freq) for a while (t) \n"
         " \t sleep(time)        <function> Pause for a while \n"
+        " \t slice(str; a; b)   <function> Characters of str from a to b (excluded) \n"
         " \t system(cmd)        <function> Execute shell code \n"
         " \t werr(...)          <function> Write text (error) \n"
         " \t write(...)         <function> Write text \n"
@@ -82,6 +94,160 @@ void kw_license(void)
     );
 }
 
+/**
+ * @brief Print a labelled number
+ *
+ * @param label
+ * @param value
+ * @param unit
+ */
+static void MEMINFO_LINE(char *label, unsigned int value, char *unit)
+{
+    char number[12] = {0};
+
+    PUTS(label);
+    PUTS(itoa(number, sizeof(number), (int)value));
+    PUTS(unit);
+}
+
+/**
+ * @brief Show heap usage and fragmentation
+ *
+ */
+void kw_meminfo(void)
+{
+    malloc_stats_t stats = mstats();
+
+    // Share of the free space outside the largest free block
+    unsigned int outside = stats.free_bytes - stats.largest;
+    unsigned int total = stats.free_bytes;
+
+    // Keep outside * 100 in 32 bits
+    for (; total > 0xFFFFFFFFU / 100; total >>= 1)
+        outside >>= 1;
+
+    unsigned int fragmentation = total ? outside * 100 / total : 0;
+
+    PUTS("\n [ MEMINFO ===== \n");
+    MEMINFO_LINE(" \t ram            ", PMM_TOTAL_FRAMES() * (PAGE_SIZE / 1024), " KiB\n");
+    MEMINFO_LINE(" \t ram free       ", PMM_FREE_FRAMES() * (PAGE_SIZE / 1024), " KiB\n");
+    MEMINFO_LINE(" \t heap           ", stats.heap, " bytes\n");
+    MEMINFO_LINE(" \t used           ", stats.used, " bytes\n");
+    MEMINFO_LINE(" \t free           ", stats.free_bytes, " bytes\n");
+    MEMINFO_LINE(" \t free blocks    ", stats.free_blocks, "\n");
+    MEMINFO_LINE(" \t largest block  ", stats.largest, " bytes\n");
+    MEMINFO_LINE(" \t fragmentation  ", fragmentation, "%\n");
+    MEMINFO_LINE(" \t slabs          ", stats.slabs, "\n");
+    MEMINFO_LINE(" \t malloc / free  ", stats.allocations, " / ");
+    MEMINFO_LINE("", stats.frees, "\n\n");
+}
+
+/**
+ * @brief Show the parsed program cache
+ *
+ */
+void kw_cacheinfo(void)
+{
+    soare_cache_stats stats = soare_getcachestats();
+
+    PUTS("\n [ CACHEINFO ===== \n");
+    MEMINFO_LINE(" \t programs       ", stats.entries, " / ");
+    MEMINFO_LINE("", CACHE_ENTRIES, "\n");
+    MEMINFO_LINE(" \t hits           ", stats.hits, "\n");
+    MEMINFO_LINE(" \t misses         ", stats.misses, "\n");
+    MEMINFO_LINE(" \t evictions      ", stats.evictions, "\n\n");
+}
+
+/**
+ * @brief Print a feature name if the processor has it
+ *
+ * @param name
+ * @param present
+ */
+static void CPUINFO_FEATURE(char *name, unsigned char present)
+{
+    if (!present)
+        return;
+
+    PUTC(' ');
+    PUTS(name);
+}
+
+/**
+ * @brief Show the processor features
+ *
+ */
+void kw_cpuinfo(void)
+{
+    PUTS("\n [ CPUINFO ===== \n");
+
+    if (!CPU.cpuid)
+    {
+        PUTS(" \t no CPUID instruction\n\n");
+        return;
+    }
+
+    PUTS(" \t vendor         ");
+    PUTS(CPU.vendor);
+    PUTC('\n');
+    MEMINFO_LINE(" \t family         ", CPU.family, "\n");
+    MEMINFO_LINE(" \t model          ", CPU.model, "\n");
+    MEMINFO_LINE(" \t stepping       ", CPU.stepping, "\n");
+
+    PUTS(" \t features      ");
+    CPUINFO_FEATURE("fpu", CPU.fpu);
+    CPUINFO_FEATURE("tsc", CPU.tsc);
+    CPUINFO_FEATURE("mmx", CPU.mmx);
+    CPUINFO_FEATURE("fxsr", CPU.fxsr);
+    CPUINFO_FEATURE("sse", CPU.sse);
+    CPUINFO_FEATURE("sse2", CPU.sse2);
+    CPUINFO_FEATURE("sse3", CPU.sse3);
+    CPUINFO_FEATURE("ssse3", CPU.ssse3);
+    CPUINFO_FEATURE("sse4.1", CPU.sse41);
+    CPUINFO_FEATURE("sse4.2", CPU.sse42);
+    CPUINFO_FEATURE("popcnt", CPU.popcnt);
+    CPUINFO_FEATURE("avx", CPU.avx);
+    PUTC('\n');
+
+    PUTS(" \t enabled       ");
+    CPUINFO_FEATURE("x87", CPU.x87_enabled);
+    CPUINFO_FEATURE("sse", CPU.sse_enabled);
+    PUTC('\n');
+
+    PUTS(" \t stdlib         ");
+    PUTS(stdlib_features() & STDLIB_SSE2 ? "sse2\n\n" : "word\n\n");
+}
+
+/**
+ * @brief Show the kernel stack usage
+ *
+ */
+void kw_stackinfo(void)
+{
+    size_t peak = STACK_PEAK();
+
+    PUTS("\n [ STACKINFO ===== \n");
+    MEMINFO_LINE(" \t watched        ", STACK_WATCHED, " bytes\n");
+    MEMINFO_LINE(" \t current        ", STACK_DEPTH(), " bytes\n");
+    MEMINFO_LINE(" \t peak           ", peak, peak < STACK_WATCHED ? " bytes\n\n" : " bytes (or more)\n\n");
+}
+
+/**
+ * @brief Show the time since boot and the timer state
+ *
+ */
+void kw_uptime(void)
+{
+    unsigned int ticks = (unsigned int)TIMER_TICKS();
+    unsigned int khz = TIMER_TSC_KHZ();
+
+    PUTS("\n [ UPTIME ===== \n");
+    MEMINFO_LINE(" \t uptime         ", ticks / TIMER_HZ, " s\n");
+    MEMINFO_LINE(" \t ticks          ", ticks, "\n");
+    MEMINFO_LINE(" \t tick           ", TIMER_TICK_NS, " ns\n");
+    MEMINFO_LINE(" \t tsc            ", khz / 1000, khz ? " MHz\n\n" : " MHz (not calibrated)\n\n");
+}
+
 /**
  * @brief Pause execution until a key is pressed
  *
@@ -101,61 +267,49 @@ void kw_pause(void)
 /**
  * @brief Get character from ASCII code
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_chr(soare_arguments_list args)
+char *fn_chr(unsigned int argc, char **argv)
 {
-    char *arg = soare_getarg(args, 0);
-
-    if (!args)
+    if (!argc || !argv[0])
         return LeaveException(UndefinedReference, "ascii_code", EmptyDocument());
 
-    char result[2] = {(char)atoi(arg), 0};
-    free(arg);
-
+    char result[2] = {(char)atoi(argv[0]), 0};
     return strdup(result);
 }
 
 /**
  * @brief Set text color
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_color(soare_arguments_list args)
+char *fn_color(unsigned int argc, char **argv)
 {
-    char *arg = soare_getarg(args, 0);
-
-    if (!args)
+    if (!argc || !argv[0])
         return LeaveException(UndefinedReference, "vga_color", EmptyDocument());
 
-    unsigned char color = (unsigned char)atoi(arg);
-    SET_GLOBAL_COLOR(color);
-    free(arg);
-
+    SET_GLOBAL_COLOR((unsigned char)atoi(argv[0]));
     return NULL;
 }
 
 /**
  * @brief Set cursor location
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_cursor(soare_arguments_list args)
+char *fn_cursor(unsigned int argc, char **argv)
 {
-    char *arg_x = soare_getarg(args, 0);
-    char *arg_y = soare_getarg(args, 1);
-
-    if (!args || !arg_y)
+    if (argc < 2 || !argv[0] || !argv[1])
         return LeaveException(UndefinedReference, "x; y", EmptyDocument());
 
-    unsigned short x = (unsigned short)atoi(arg_x);
-    unsigned short y = (unsigned short)atoi(arg_y);
-
-    free(arg_x);
-    free(arg_y);
+    unsigned short x = (unsigned short)atoi(argv[0]);
+    unsigned short y = (unsigned short)atoi(argv[1]);
 
     SET_CURSOR(y * SCREEN_TEXT_WIDTH + x);
 
@@ -165,28 +319,26 @@ char *fn_cursor(soare_arguments_list args)
 /**
  * @brief Evaluate SOARE code (system too)
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_eval(soare_arguments_list args)
+char *fn_eval(unsigned int argc, char **argv)
 {
-    char *arg = soare_getarg(args, 0);
-
-    if (!args)
+    if (!argc || !argv[0])
         return LeaveException(UndefinedReference, "code", EmptyDocument());
 
-    char *result = Execute("eval", arg);
-    free(arg);
-    return result;
+    return Execute("eval", argv[0]);
 }
 
 /**
  * @brief Get char from keyboard
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_getc(soare_arguments_list args)
+char *fn_getc(unsigned int argc, char **argv)
 {
     char result[2] = {GETC(), 0};
     return strdup(result);
@@ -195,22 +347,15 @@ char *fn_getc(soare_arguments_list args)
 /**
  * @brief Write text
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_write(soare_arguments_list args)
+char *fn_write(unsigned int argc, char **argv)
 {
-    char *value = NULL;
-
-    // Loop through all arguments and print them
-    for (int i = 0; 1; i++)
-    {
-        if (!(value = soare_getarg(args, i)))
-            break;
-
-        PUTS(value);
-        free(value);
-    }
+    // Print the arguments until one has no value
+    for (unsigned int i = 0; i < argc && argv[i]; i++)
+        PUTS(argv[i]);
 
     return NULL;
 }
@@ -218,12 +363,13 @@ char *fn_write(soare_arguments_list args)
 /**
  * @brief Input text from user
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_input(soare_arguments_list args)
+char *fn_input(unsigned int argc, char **argv)
 {
-    fn_write(args);
+    fn_write(argc, argv);
 
     char input[__SOARE_MAX_INPUT__] = {0};
     GETS(input, sizeof(input));
@@ -234,44 +380,35 @@ char *fn_input(soare_arguments_list args)
 /**
  * @brief Check if a key is pressed
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_keydown(soare_arguments_list args)
+char *fn_keydown(unsigned int argc, char **argv)
 {
-    char *arg = soare_getarg(args, 0);
-
-    if (!args)
+    if (!argc || !argv[0])
         return LeaveException(UndefinedReference, "scancode", EmptyDocument());
 
-    unsigned char scancode = (unsigned char)atoi(arg);
-    free(arg);
-
-    // Check if the specified key is pressed
-    if (INB(KEYBOARD_PORT) == scancode)
-        return strdup("1");
+    unsigned char scancode = (unsigned char)atoi(argv[0]);
 
-    return strdup("0");
+    // Check if the specified key is held down
+    return strdup(KEYBOARD_PRESSED(scancode) ? "1" : "0");
 }
 
 /**
  * @brief Get ASCII code from character
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_ord(soare_arguments_list args)
+char *fn_ord(unsigned int argc, char **argv)
 {
-    char *arg = soare_getarg(args, 0);
-
-    if (!args)
+    if (!argc || !argv[0])
         return LeaveException(UndefinedReference, "character", EmptyDocument());
 
-    int ascii_code = (int)arg[0];
-    free(arg);
-
     char result[4] = {0};
-    itoa(result, sizeof(result), ascii_code);
+    itoa(result, sizeof(result), (int)argv[0][0]);
 
     return strdup(result);
 }
@@ -279,22 +416,17 @@ char *fn_ord(soare_arguments_list args)
 /**
  * @brief Play frequency for a while
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_play_note(soare_arguments_list args)
+char *fn_play_note(unsigned int argc, char **argv)
 {
-    char *arg_note = soare_getarg(args, 0);
-    char *arg_time = soare_getarg(args, 1);
-
-    if (!arg_note || !arg_time)
+    if (argc < 2 || !argv[0] || !argv[1])
         return LeaveException(UndefinedReference, "note; time", EmptyDocument());
 
-    unsigned int note = (unsigned int)atoi(arg_note);
-    unsigned int time = (unsigned int)atoi(arg_time);
-
-    free(arg_note);
-    free(arg_time);
+    unsigned int note = (unsigned int)atoi(argv[0]);
+    unsigned int time = (unsigned int)atoi(argv[1]);
 
     PLAY_FREQUENCY(note);
     SLEEP(time);
@@ -304,22 +436,54 @@ char *fn_play_note(soare_arguments_list args)
 }
 
 /**
- * @brief Sleep for a while
+ * @brief Part of a string, from start to end (excluded)
  *
- * @param args
+ * Negative positions count from the end, and positions are clamped to the
+ * string. Without end, the slice goes to the end of the string.
+ *
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_sleep(soare_arguments_list args)
+char *fn_slice(unsigned int argc, char **argv)
 {
-    char *arg = soare_getarg(args, 0);
+    if (argc < 2 || !argv[0] || !argv[1])
+        return LeaveException(UndefinedReference, "string; start", EmptyDocument());
 
-    if (!args)
-        return LeaveException(UndefinedReference, "time", EmptyDocument());
+    int length = (int)strlen(argv[0]);
+    int start = atoi(argv[1]);
+    int end = argc > 2 && argv[2] ? atoi(argv[2]) : length;
 
-    unsigned int time = (unsigned int)atoi(arg);
-    free(arg);
+    start = start < 0 ? start + length : start;
+    end = end < 0 ? end + length : end;
 
-    SLEEP(time);
+    start = start < 0 ? 0 : start > length ? length : start;
+    end = end < start ? start : end > length ? length : end;
+
+    char *result = malloc((size_t)(end - start) + 1);
+
+    if (!result)
+        return LeaveException(InterpreterError, "OUT OF MEMORY", EmptyDocument());
+
+    memmove(result, argv[0] + start, (size_t)(end - start));
+    result[end - start] = 0;
+
+    return result;
+}
+
+/**
+ * @brief Sleep for a while
+ *
+ * @param argc
+ * @param argv
+ * @return char*
+ */
+char *fn_sleep(unsigned int argc, char **argv)
+{
+    if (!argc || !argv[0])
+        return LeaveException(UndefinedReference, "time", EmptyDocument());
+
+    SLEEP((unsigned int)atoi(argv[0]));
 
     return NULL;
 }
@@ -327,15 +491,16 @@ char *fn_sleep(soare_arguments_list args)
 /**
  * @brief Write text (error)
  *
- * @param args
+ * @param argc
+ * @param argv
  * @return char*
  */
-char *fn_werr(soare_arguments_list args)
+char *fn_werr(unsigned int argc, char **argv)
 {
     unsigned char color = GET_GLOBAL_COLOR();
 
     SET_GLOBAL_COLOR(0x4);
-    fn_write(args);
+    fn_write(argc, argv);
     SET_GLOBAL_COLOR(color);
 
     return NULL;
@@ -347,24 +512,32 @@ char *fn_werr(soare_arguments_list args)
  */
 void INIT_SOARE_KERNEL(void)
 {
+    soare_addkeyword("benchmark", BENCHMARK);
+    soare_addkeyword("cacheinfo", kw_cacheinfo);
     soare_addkeyword("clear", SCREEN_CLEAR);
+    soare_addkeyword("cpuinfo", kw_cpuinfo);
     soare_addkeyword("editor", EDITOR);
     soare_addkeyword("help", kw_help);
     soare_addkeyword("license", kw_license);
+    soare_addkeyword("meminfo", kw_meminfo);
     soare_addkeyword("pause", kw_pause);
+    soare_addkeyword("selfcheck", SELFCHECK);
     soare_addkeyword("setup", SETUP);
-
-    soare_addfunction("chr", fn_chr);
-    soare_addfunction("color", fn_color);
-    soare_addfunction("cursor", fn_cursor);
-    soare_addfunction("eval", fn_eval);
-    soare_addfunction("getc", fn_getc);
-    soare_addfunction("input", fn_input);
-    soare_addfunction("keydown", fn_keydown);
-    soare_addfunction("ord", fn_ord);
-    soare_addfunction("play_note", fn_play_note);
-    soare_addfunction("sleep", fn_sleep);
-    soare_addfunction("system", fn_eval);
-    soare_addfunction("werr", fn_werr);
-    soare_addfunction("write", fn_write);
+    soare_addkeyword("stackinfo", kw_stackinfo);
+    soare_addkeyword("uptime", kw_uptime);
+
+    soare_addnative("chr", fn_chr);
+    soare_addnative("color", fn_color);
+    soare_addnative("cursor", fn_cursor);
+    soare_addnative("eval", fn_eval);
+    soare_addnative("getc", fn_getc);
+    soare_addnative("input", fn_input);
+    soare_addnative("keydown", fn_keydown);
+    soare_addnative("ord", fn_ord);
+    soare_addnative("play_note", fn_play_note);
+    soare_addnative("sleep", fn_sleep);
+    soare_addnative("slice", fn_slice);
+    soare_addnative("system", fn_eval);
+    soare_addnative("werr", fn_werr);
+    soare_addnative("write", fn_write);
 }
@@ -0,0 +1,71 @@
+#include <STD/stdlib.h>
+#include <STD/stdint.h>
+
+/**
+ *
+ *  _____  _____ _____ _____ _   _ __  __
+ * | ___ \|  _  | ___ \_   _| | | |  \/  |
+ * | |_/ /| | | | |_/ / | | | | | | .  . |
+ * | ___ \| | | |    /  | | | | | | |\/| |
+ * | |_/ /\ \_/ / |\ \ _| |_| |_| | |  | |
+ * \____/  \___/\_| \_|\___/ \___/\_|  |_/
+ *
+ * Antoine LANDRIEUX (MIT License) <stack.c>
+ * <https://github.com/AntoineLandrieux/BORIUM/>
+ *
+ */
+
+#include <stack.h>
+
+/**
+ * @brief Current stack pointer
+ *
+ * @return uintptr_t
+ */
+static inline uintptr_t stack_pointer(void)
+{
+    uintptr_t esp;
+    __asm__ volatile("mov %%esp, %0" : "=r"(esp));
+    return esp;
+}
+
+/**
+ * @brief Fill the unused part of the watched stack with STACK_PAINT
+ *
+ */
+void STACK_INIT(void)
+{
+    // Words below the stack pointer are not used yet (no interrupts)
+    uint32_t *word = (uint32_t *)(STACK_TOP - STACK_WATCHED);
+    uint32_t *end = (uint32_t *)(stack_pointer() & ~3U);
+
+    for (; word < end; word++)
+        *word = STACK_PAINT;
+}
+
+/**
+ * @brief Deepest stack use since STACK_INIT, in bytes
+ *
+ * @return size_t (STACK_WATCHED if the whole watched area was used)
+ */
+size_t STACK_PEAK(void)
+{
+    // The stack grows down: the first overwritten word is the deepest
+    uint32_t *word = (uint32_t *)(STACK_TOP - STACK_WATCHED);
+    uint32_t *end = (uint32_t *)STACK_TOP;
+
+    for (; word < end && *word == STACK_PAINT; word++)
+        ;
+
+    return STACK_TOP - (uintptr_t)word;
+}
+
+/**
+ * @brief Current stack use, in bytes
+ *
+ * @return size_t
+ */
+size_t STACK_DEPTH(void)
+{
+    return STACK_TOP - stack_pointer();
+}